@@ -19,6 +19,23 @@ target_include_directories(libdeps SYSTEM INTERFACE ${HDF5_INCLUDE_DIRS})
 target_link_libraries(libdeps INTERFACE ${HDF5_C_LIBRARIES})
 target_compile_definitions(libdeps INTERFACE ${HDF5_DEFINITIONS})
 
+# Threads, for background reads
+find_package(Threads REQUIRED)
+target_link_libraries(libdeps INTERFACE Threads::Threads)
+
+# zlib, for compressing chunks outside of HDF5. Optional: ChunkWriter and
+# ChunkReader are left out without it
+if(HIGHFIVE_USE_ZLIB)
+  find_package(ZLIB)
+  if(ZLIB_FOUND)
+    target_include_directories(libdeps SYSTEM INTERFACE ${ZLIB_INCLUDE_DIRS})
+    target_link_libraries(libdeps INTERFACE ${ZLIB_LIBRARIES})
+    target_compile_definitions(libdeps INTERFACE H5_USE_ZLIB)
+  else()
+    message(STATUS "zlib not found, ChunkWriter and ChunkReader disabled")
+  endif()
+endif()
+
 # Boost
 if(HIGHFIVE_USE_BOOST)
   set(Boost_NO_BOOST_CMAKE TRUE)  # Consistency
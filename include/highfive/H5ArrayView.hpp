@@ -0,0 +1,86 @@
+/*
+ *  Copyright (c), 2020, Blue Brain Project - EPFL
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#ifndef H5ARRAYVIEW_HPP
+#define H5ARRAYVIEW_HPP
+
+#include <array>
+#include <cstddef>
+
+#include "H5DataSpace.hpp"
+
+namespace HighFive {
+
+///
+/// \brief Non-owning, possibly strided, N-dimensional view over user memory
+///
+/// Reading to / writing from a view transfers data directly between the
+/// dataset and the viewed elements, e.g. a column of an interleaved array or
+/// a sub-block of an image, without packing them in a temporary buffer.
+///
+/// Strides are expressed in number of elements. Elements must be laid out in
+/// row-major order, i.e. each stride spans at least the extent of the inner
+/// dimensions.
+///
+/// \code{.cpp}
+/// // Column 2 of a 100x4 row-major array
+/// double array[100][4];
+/// dataset.read(ArrayView<double, 1>(&array[0][2], {100}, {4}));
+/// \endcode
+template <typename T, std::size_t N>
+class ArrayView {
+  public:
+    using value_type = T;
+
+    ///
+    /// \brief Create a view over a dense row-major array
+    ///
+    ArrayView(T* ptr, const std::array<std::size_t, N>& dims);
+
+    ///
+    /// \brief Create a strided view
+    /// \param ptr Pointer to the first element of the view
+    /// \param dims Number of elements in each dimension
+    /// \param strides Distance, in elements, between consecutive elements of each dimension
+    ArrayView(T* ptr,
+              const std::array<std::size_t, N>& dims,
+              const std::array<std::size_t, N>& strides);
+
+    inline T* data() const noexcept {
+        return _data;
+    }
+
+    inline const std::array<std::size_t, N>& getDimensions() const noexcept {
+        return _dims;
+    }
+
+    inline const std::array<std::size_t, N>& getStrides() const noexcept {
+        return _strides;
+    }
+
+    ///
+    /// \brief Total number of elements in the view
+    ///
+    std::size_t getElementCount() const noexcept;
+
+    ///
+    /// \brief Memory DataSpace selecting the viewed elements, relative to data()
+    ///
+    DataSpace getMemSpace() const;
+
+  private:
+    T* _data;
+    std::array<std::size_t, N> _dims;
+    std::array<std::size_t, N> _strides;
+};
+
+}  // namespace HighFive
+
+#include "bits/H5ArrayView_misc.hpp"
+
+#endif  // H5ARRAYVIEW_HPP
@@ -0,0 +1,141 @@
+/*
+ *  Copyright (c), 2020, Blue Brain Project - EPFL
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#ifndef H5CHUNKRANGE_HPP
+#define H5CHUNKRANGE_HPP
+
+#include <cstddef>
+#include <future>
+#include <iterator>
+#include <vector>
+
+#include "H5DataSet.hpp"
+
+namespace HighFive {
+
+///
+/// \brief Iterates over a dataset by blocks aligned on its chunks
+///
+/// Each block covers one chunk of the dataset (clipped at its edges), so that
+/// each chunk is read, and decompressed, exactly once. Blocks come in the
+/// order of their chunks in the file, chunks which were never written last,
+/// so that the file is read sequentially. Before HDF5 1.10.5, which can't
+/// report where chunks are stored, they come in row-major order of the chunk
+/// grid. Datasets which aren't chunked are iterated by blocks of whole rows
+/// of about 1 MiB.
+///
+/// When HDF5 is built thread-safe, the next block is read on a background
+/// thread while the current one is processed. The range must not be moved
+/// while being iterated.
+///
+/// \code{.cpp}
+/// for (const auto& block : dataset.chunks<double>()) {
+///     process(block.offset, block.count, block.data);
+/// }
+/// \endcode
+template <typename T>
+class ChunkRange {
+  public:
+    struct Block {
+        /// \brief Position of the block in the dataset
+        std::vector<std::size_t> offset;
+        /// \brief Extent of the block
+        std::vector<std::size_t> count;
+        /// \brief Elements of the block, in row-major order
+        std::vector<T> data;
+    };
+
+    class iterator {
+      public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Block;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Block*;
+        using reference = const Block&;
+
+        inline reference operator*() const {
+            return _range->_current;
+        }
+        inline pointer operator->() const {
+            return &_range->_current;
+        }
+        inline iterator& operator++() {
+            _range->advance();
+            ++_index;
+            return *this;
+        }
+        inline bool operator==(const iterator& other) const noexcept {
+            return _index == other._index;
+        }
+        inline bool operator!=(const iterator& other) const noexcept {
+            return _index != other._index;
+        }
+
+      private:
+        inline iterator(ChunkRange* range, std::size_t index)
+            : _range(range)
+            , _index(index) {}
+
+        ChunkRange* _range;
+        std::size_t _index;
+
+        friend class ChunkRange;
+    };
+
+    ///
+    /// \brief Start iterating, reading the first block
+    iterator begin();
+
+    iterator end();
+
+    /// \brief Number of blocks
+    inline std::size_t size() const noexcept {
+        return _n_blocks;
+    }
+
+    /// \brief Extent of the blocks, except at the edges of the dataset
+    inline const std::vector<std::size_t>& getBlockDimensions() const noexcept {
+        return _block_dims;
+    }
+
+  private:
+    ChunkRange(const DataSet& dataset, bool prefetch);
+
+    // Reads the block at the given index of the grid
+    void load(std::size_t index, Block& block) const;
+
+    // Position of the block at the given index of the grid
+    void getOffset(std::size_t index, std::vector<std::size_t>& offset) const;
+
+    // Orders the blocks by the file address of their chunks
+    void sortByAddress();
+
+    // Makes the next block current and starts reading the following one
+    void advance();
+
+    void startPrefetch(std::size_t index);
+
+    DataSet _dataset;
+    std::vector<std::size_t> _dims;
+    std::vector<std::size_t> _block_dims;
+    std::size_t _n_blocks;
+    // Index in the grid of each block, in iteration order, empty if row-major
+    std::vector<std::size_t> _order;
+    bool _prefetch;
+
+    std::size_t _index;
+    Block _current;
+    Block _next;
+    std::future<void> _pending;
+
+    friend class DataSet;
+};
+
+}  // namespace HighFive
+
+#endif  // H5CHUNKRANGE_HPP
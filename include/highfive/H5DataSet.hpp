@@ -9,6 +9,11 @@
 #ifndef H5DATASET_HPP
 #define H5DATASET_HPP
 
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <utility>
 #include <vector>
 
 #include "H5DataSpace.hpp"
@@ -21,9 +26,29 @@
 
 namespace HighFive {
 
+///
+/// \brief Activity of the chunk cache of a dataset, see
+/// DataSet::enableCacheStatistics()
+struct ChunkCacheStatistics {
+    size_t hits = 0;
+    size_t misses = 0;
+
+    /// \brief Share of the chunk accesses found in the cache, 0 without access
+    inline double getHitRate() const noexcept {
+        return hits + misses > 0
+                   ? static_cast<double>(hits) / static_cast<double>(hits + misses)
+                   : 0.;
+    }
+};
+
 ///
 /// \brief Class representing a dataset.
 ///
+/// The dataspace and datatype of the dataset are queried once and cached in
+/// the handle, shared with its copies and with the selections made from it.
+/// resize() refreshes them; changes to the extent done through another,
+/// independently opened, handle of the same dataset are not seen.
+///
 class DataSet : public Object,
                 public SliceTraits<DataSet>,
                 public AnnotateTraits<DataSet> {
@@ -50,7 +75,8 @@ class DataSet : public Object,
 
     ///
     /// \brief getDataType
-    /// \return return the datatype associated with this dataset
+    /// \return return the datatype associated with this dataset, a copy that
+    /// can be modified
     ///
     DataType getDataType() const;
 
@@ -80,8 +106,19 @@ class DataSet : public Object,
     ///       This is a shorthand for getSpace().getDimensions()
     /// \return The shape of the current HighFive::DataSet
     ///
+    /// The dimensions are queried once and shared by the copies of the
+    /// handle, kept up to date by their resize(). A handle opened separately,
+    /// e.g. with another getDataSet(), doesn't see them: use getSpace() then.
     inline std::vector<size_t> getDimensions() const {
-        return getSpace().getDimensions();
+        return getMetadata()->dims;
+    }
+
+    /// \brief Get the maximum dimensions of the whole DataSet.
+    ///       This is a shorthand for getSpace().getMaxDimensions()
+    ///
+    /// Cached as getDimensions().
+    inline std::vector<size_t> getMaxDimensions() const {
+        return getMetadata()->max_dims;
     }
 
     /// \brief Get the total number of elements in the current dataset.
@@ -90,9 +127,67 @@ class DataSet : public Object,
     /// \return The shape of the current HighFive::DataSet
     ///
     inline size_t getElementCount() const {
-        return getSpace().getElementCount();
+        const auto metadata = getMetadata();
+        return std::accumulate(metadata->dims.begin(), metadata->dims.end(), size_t{1},
+                               std::multiplies<size_t>());
     }
 
+    ///
+    /// \brief Iterate over the dataset by blocks aligned on its chunks,
+    /// prefetching the next block in the background if \p prefetch is set.
+    /// See ChunkRange.
+    template <typename T>
+    ChunkRange<T> chunks(bool prefetch = true) const;
+
+    ///
+    /// \brief Read several ranges of rows (first dimension) in a single call
+    ///
+    /// The union of the ranges is read at once. Rows of ranges given in
+    /// increasing order, without overlap, land directly in \p out; others are
+    /// copied from the union.
+    /// \param ranges Ranges of rows [first, last)
+    /// \param out Rows of all the ranges, contiguous, in the order of \p ranges
+    /// \param xfer_props Transfer properties, e.g. a larger HyperVectorSize
+    ///        for many ranges
+    /// \return Index of the first row of each range in \p out, followed by
+    ///         the total number of rows
+    /// \exception DataSpaceException if a range is out of the dataset
+    template <typename T>
+    std::vector<size_t> readRanges(const std::vector<std::pair<size_t, size_t>>& ranges,
+                                   std::vector<T>& out,
+                                   const DataTransferProps& xfer_props = DataTransferProps()) const;
+
+#ifdef H5_HAVE_PARALLEL
+    ///
+    /// \brief Append the rows of every rank of \p comm, in rank order
+    ///
+    /// Collective: the ranks exchange their numbers of rows (MPI_Exscan), the
+    /// dataset is extended once, then every rank writes its block with
+    /// collective MPI-IO. Ranks without rows still take part. The dataset
+    /// must be chunked, with an unlimited first dimension, in a file opened
+    /// with MPIOFileDriver.
+    /// \param comm The communicator of the file
+    /// \param local_rows Rows of this rank, contiguous, row-major
+    /// \return Index in the dataset of the first row of this rank
+    /// \exception DataSpaceException if \p local_rows isn't made of whole rows
+    template <typename T>
+    size_t writeDistributed(MPI_Comm comm, const std::vector<T>& local_rows);
+#endif
+
+    ///
+    /// \brief Start counting the hits and misses of the chunk cache
+    ///
+    /// The reads and writes done through this handle, its copies and their
+    /// selections are replayed on a model of the chunk cache, configured as
+    /// the one of the handle (see Caching). The counts are estimates: HDF5
+    /// doesn't report them. Counting again resets them.
+    /// \exception DataSetException if the dataset isn't chunked
+    void enableCacheStatistics();
+
+    ///
+    /// \brief Hits and misses of the chunk cache since enableCacheStatistics()
+    ChunkCacheStatistics getCacheStatistics() const;
+
   protected:
     using Object::Object;
 
@@ -101,6 +196,33 @@ class DataSet : public Object,
     friend class Reference;
     template <typename Derivate> friend class NodeTraits;
 
+  private:
+    struct Metadata {
+        // Never modified once loaded: resize() drops it, and the next access
+        // loads a new one, so that handles sharing the block (copies,
+        // selections, a ChunkRange prefetching) keep a consistent view
+        struct Snapshot {
+            DataSpace space;
+            DataType data_type;
+            std::vector<size_t> dims;
+            std::vector<size_t> max_dims;
+        };
+        // Guards snapshot
+        std::mutex mutex;
+        std::shared_ptr<const Snapshot> snapshot;
+        // Kept through resize
+        std::shared_ptr<details::ChunkCacheModel> cache_model;
+    };
+
+    // Loads the metadata on first use
+    std::shared_ptr<const Metadata::Snapshot> getMetadata() const;
+
+    mutable std::shared_ptr<Metadata> _metadata = std::make_shared<Metadata>();
+
+    friend DataSpace details::get_file_space(const DataSet&);
+    friend DataType details::get_file_datatype(const DataSet&);
+    friend void details::record_chunk_access(const DataSet&, const DataSpace&);
+
 };
 
 }  // namespace HighFive
@@ -0,0 +1,119 @@
+/*
+ *  Copyright (c), 2020, Blue Brain Project - EPFL
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#ifndef H5DATASETAPPENDER_HPP
+#define H5DATASETAPPENDER_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "H5DataSet.hpp"
+#include "H5Selection.hpp"
+#include "H5Utility.hpp"
+
+namespace HighFive {
+
+///
+/// \brief Appends rows to an extensible, chunked, dataset
+///
+/// Rows (along the first dimension) are buffered in memory and written by
+/// blocks aligned on the chunks of the dataset. The extent of the dataset is
+/// grown geometrically, so that appending costs an amortized constant number
+/// of H5Dset_extent calls. flush() writes the pending rows and trims the
+/// extent to the rows actually appended; it's done as well on destruction.
+///
+/// Until flush() is called, readers of the file can see rows filled with the
+/// fill value beyond the appended ones.
+///
+/// \code{.cpp}
+/// DataSetCreateProps props;
+/// props.add(Chunking(std::vector<hsize_t>{1024, 3}));
+/// auto dataset = file.createDataSet<double>(
+///     "samples", DataSpace({0, 3}, {DataSpace::UNLIMITED, 3}), props);
+/// DataSetAppender<double> appender(dataset);
+/// for (const auto& sample : samples) {
+///     appender.append(sample.data());  // 3 values per row
+/// }
+/// appender.flush();
+/// \endcode
+template <typename T>
+class DataSetAppender {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "DataSetAppender requires trivially copyable elements");
+
+  public:
+    ///
+    /// \brief Append to the end of a chunked dataset of rank >= 1
+    /// \param dataset The dataset, whose first dimension is extended
+    /// \param block_rows Rows written at once. By default, as many chunks as
+    ///        fit in 1 MiB, and at least one.
+    /// \exception DataSetException if the dataset isn't chunked
+    explicit DataSetAppender(const DataSet& dataset, std::size_t block_rows = 0);
+
+    DataSetAppender(const DataSetAppender&) = delete;
+    DataSetAppender& operator=(const DataSetAppender&) = delete;
+
+    /// \brief Flushes the pending rows. Errors can't be reported from a
+    /// destructor and are ignored: call flush() to get them as exceptions.
+    ~DataSetAppender();
+
+    ///
+    /// \brief Append a value to a 1D dataset
+    /// \exception DataSpaceException if rows have more than one element
+    void append(const T& value);
+
+    ///
+    /// \brief Append a row of getRowSize() elements
+    void append(const T* row);
+
+    ///
+    /// \brief Append n_rows consecutive rows of getRowSize() elements
+    void append(const T* rows, std::size_t n_rows);
+
+    ///
+    /// \brief Write the pending rows and trim the dataset to size()
+    void flush();
+
+    /// \brief Number of rows of the dataset, including the pending ones
+    inline std::size_t size() const noexcept {
+        return _n_written + _n_pending;
+    }
+
+    /// \brief Number of elements in a row
+    inline std::size_t getRowSize() const noexcept {
+        return _row_size;
+    }
+
+    inline const DataSet& getDataSet() const noexcept {
+        return _dataset;
+    }
+
+  private:
+    // Writes the pending rows, extending the dataset if needed
+    void writePending();
+
+    // Number of rows to buffer before the next write, so that writes
+    // end on a block boundary
+    std::size_t rowsToBoundary() const noexcept;
+
+    DataSet _dataset;
+    std::vector<std::size_t> _dims;
+    std::size_t _max_rows;
+    std::size_t _row_size;
+    std::size_t _block_rows;
+    std::size_t _n_written;
+    std::size_t _n_pending;
+    std::vector<T, DefaultInitAllocator<T>> _buffer;
+};
+
+}  // namespace HighFive
+
+#include "bits/H5DataSetAppender_misc.hpp"
+
+#endif  // H5DATASETAPPENDER_HPP
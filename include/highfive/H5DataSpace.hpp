@@ -118,8 +118,8 @@ class DataSpace : public Object {
     ///  - vector of fundamental types
     ///  - vector of std::string
     ///  - boost::multi_array (with H5_USE_BOOST defined)
-    template <typename Value>
-    static DataSpace From(const std::vector<Value>& container);
+    template <typename Value, typename Allocator>
+    static DataSpace From(const std::vector<Value, Allocator>& container);
 
     /// Create a dataspace matching the container dimensions for a
     /// std::array.
@@ -9,9 +9,15 @@
 #ifndef H5DATATYPE_HPP
 #define H5DATATYPE_HPP
 
+#include <initializer_list>
+#include <string>
 #include <vector>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
 
 #include "H5Object.hpp"
+#include "H5Utility.hpp"
 #include "bits/H5Utils.hpp"
 
 namespace HighFive {
@@ -256,6 +262,11 @@ class FixedLenStringArray {
 
     FixedLenStringArray(const std::initializer_list<std::string> &);
 
+    ///
+    /// \brief Create a FixedStringArray from a StringColumn, in one pass
+    ///
+    explicit FixedLenStringArray(const StringColumn& column);
+
     ///
     /// \brief Append an std::string to the buffer structure
     ///
@@ -268,6 +279,31 @@ class FixedLenStringArray {
     ///
     std::string getString(std::size_t index) const;
 
+    ///
+    /// \brief Length of the string at index i, without the padding
+    ///
+    std::size_t length(std::size_t i) const noexcept;
+
+    ///
+    /// \brief Retrieve all the strings at once. The content of \p strings
+    /// is replaced, reusing its capacity where possible.
+    ///
+    void getStrings(std::vector<std::string>& strings) const;
+
+    std::vector<std::string> getStrings() const;
+
+#if __cplusplus >= 201703L
+    ///
+    /// \brief Retrieve a non-owning view of a string, valid as long as the
+    /// array is not modified
+    ///
+    inline std::string_view getStringView(std::size_t i) const noexcept {
+        return std::string_view(operator[](i), length(i));
+    }
+
+    std::vector<std::string_view> getStringViews() const;
+#endif
+
     // Container interface
     inline const char* operator[](std::size_t i) const noexcept {
         return datavec[i].data();
@@ -291,14 +327,17 @@ class FixedLenStringArray {
         return datavec.back().data();
     }
     inline char* data() noexcept {
-        return datavec[0].data();
+        return reinterpret_cast<char*>(datavec.data());
     }
     inline const char* data() const noexcept {
-        return datavec[0].data();
+        return reinterpret_cast<const char*>(datavec.data());
     }
 
   private:
-    using vector_t = typename std::vector<std::array<char, N>>;
+    // Elements are not zeroed on resize: reads overwrite them entirely and
+    // writes from strings pad them explicitly
+    using vector_t = typename std::vector<std::array<char, N>,
+                                          DefaultInitAllocator<std::array<char, N>>>;
 
   public:
     // Use the underlying iterator
@@ -343,6 +382,85 @@ class FixedLenStringArray {
     vector_t datavec;
 };
 
+namespace details {
+class StringArena;
+}
+
+///
+/// \brief A column of variable-length strings stored in a single buffer
+///
+/// All strings live, null-terminated, in one contiguous character buffer
+/// indexed by an offsets array. Reading a variable-length string dataset into
+/// a StringColumn takes a constant number of allocations instead of one per
+/// string as with std::vector<std::string>.
+///
+class StringColumn {
+  public:
+    StringColumn() = default;
+
+    ///
+    /// \brief Create a StringColumn from a sequence of strings (copied)
+    ///
+    explicit StringColumn(const std::vector<std::string>& vec);
+
+    StringColumn(const std::initializer_list<std::string>& init_list);
+
+    ///
+    /// \brief Reserve space for \p n_strings totalling \p n_chars characters
+    ///
+    void reserve(std::size_t n_strings, std::size_t n_chars);
+
+    ///
+    /// \brief Append a string to the column
+    ///
+    void push_back(const char* str, std::size_t length);
+
+    void push_back(const std::string& str);
+
+    void clear() noexcept;
+
+    ///
+    /// \brief Retrieve a string from the structure as std::string
+    ///
+    std::string getString(std::size_t index) const;
+
+#if __cplusplus >= 201703L
+    ///
+    /// \brief Retrieve a non-owning view of a string
+    ///
+    inline std::string_view getStringView(std::size_t i) const noexcept {
+        return std::string_view(operator[](i), length(i));
+    }
+#endif
+
+    /// \brief Null-terminated string at index i
+    inline const char* operator[](std::size_t i) const noexcept {
+        return _chars.data() + _offsets[i];
+    }
+
+    /// \brief Length of the string at index i, not counting the terminator
+    inline std::size_t length(std::size_t i) const noexcept {
+        return _offsets[i + 1] - _offsets[i] - 1;
+    }
+
+    inline std::size_t size() const noexcept {
+        return _offsets.size() - 1;
+    }
+
+    inline bool empty() const noexcept {
+        return size() == 0;
+    }
+
+  private:
+    // Characters of all the strings, each one followed by '\0'
+    std::vector<char, DefaultInitAllocator<char>> _chars;
+    // Start of each string in _chars, plus the end of the last one
+    std::vector<std::size_t> _offsets = {0};
+
+    template <typename Derivate> friend class SliceTraits;
+    friend class details::StringArena;
+};
+
 }  // namespace HighFive
 
 
@@ -0,0 +1,208 @@
+/*
+ *  Copyright (c), 2020, Blue Brain Project - EPFL
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#ifndef H5DIRECTCHUNK_HPP
+#define H5DIRECTCHUNK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <H5public.h>
+
+#include "H5DataSet.hpp"
+
+#if defined(H5_USE_ZLIB) && H5_VERSION_GE(1, 10, 3)
+
+namespace HighFive {
+
+namespace details {
+
+///
+/// \brief The filter pipeline of a dataset, applied outside of HDF5
+///
+/// Only the shuffle and deflate filters are supported, in any order, on
+/// datasets filtering their partial edge chunks (the default).
+class ChunkFilters {
+  public:
+    explicit ChunkFilters(const DataSet& dataset);
+
+    ///
+    /// \brief Apply the filters to a chunk, in pipeline order
+    /// \param chunk The raw chunk, replaced by the filtered one
+    /// \param scratch Working buffer, reused between calls
+    void encode(std::vector<char>& chunk, std::vector<char>& scratch) const;
+
+    ///
+    /// \brief Revert the filters of a chunk, in reverse pipeline order
+    /// \param chunk The stored chunk, replaced by the raw one
+    /// \param scratch Working buffer, reused between calls
+    /// \param filter_mask Filters skipped when writing the chunk
+    /// \param chunk_bytes Size of the raw chunk
+    void decode(std::vector<char>& chunk, std::vector<char>& scratch,
+                std::uint32_t filter_mask, std::size_t chunk_bytes) const;
+
+  private:
+    struct Filter {
+        H5Z_filter_t id;
+        unsigned parameter;  // element size for shuffle, level for deflate
+    };
+
+    std::vector<Filter> _filters;
+};
+
+}  // namespace details
+
+///
+/// \brief Writes chunked datasets, compressing the chunks on several threads
+///
+/// The filters of the dataset (shuffle and deflate) are applied by HighFive
+/// with zlib, on a pool of threads started for each write. The calling
+/// thread stores the compressed chunks with H5Dwrite_chunk as they are done,
+/// while the next ones are compressed. The chunks hold the same data as
+/// through H5Dwrite, edges outside of the dataset holding the fill value, and
+/// are readable by any HDF5 application.
+///
+/// Data is written by whole chunks: blocks must start on chunk boundaries and
+/// end on chunk boundaries or at the edges of the dataset. At most a few
+/// compressed chunks per thread wait to be written, bounding the memory
+/// used. The type of the dataset must be the one of T, as no conversion is
+/// done.
+///
+/// Only available when HighFive is built with zlib (H5_USE_ZLIB) and
+/// HDF5 >= 1.10.3.
+///
+/// \code{.cpp}
+/// DataSetCreateProps props;
+/// props.add(Chunking(std::vector<hsize_t>{256, 256}));
+/// props.add(Shuffle());
+/// props.add(Deflate(6));
+/// auto dataset = file.createDataSet<float>("image", DataSpace({4096, 4096}), props);
+/// ChunkWriter<float>(dataset).write(image.data());
+/// \endcode
+template <typename T>
+class ChunkWriter {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "ChunkWriter requires trivially copyable elements");
+
+  public:
+    ///
+    /// \brief Prepare writing to a chunked dataset
+    /// \param dataset The dataset, of the same type as T
+    /// \param n_threads Threads compressing chunks, by default one per core
+    /// \exception DataSetException if the dataset isn't chunked, has
+    ///            unsupported filters or doesn't filter partial chunks
+    /// \exception DataTypeException if the type of the dataset isn't T
+    explicit ChunkWriter(const DataSet& dataset, std::size_t n_threads = 0);
+
+    ///
+    /// \brief Write the whole dataset from a row-major buffer
+    void write(const T* data);
+
+    ///
+    /// \brief Write a block of whole chunks from a row-major buffer
+    /// \param offset Start of the block, a multiple of the chunk dimensions
+    /// \param count Extent of the block, a multiple of the chunk dimensions
+    ///        unless it reaches the edge of the dataset
+    /// \param data count elements, row-major
+    void write(const std::vector<std::size_t>& offset,
+               const std::vector<std::size_t>& count,
+               const T* data);
+
+    /// \brief Extent of the chunks of the dataset
+    inline const std::vector<std::size_t>& getChunkDimensions() const noexcept {
+        return _chunk_dims;
+    }
+
+    inline std::size_t getThreadCount() const noexcept {
+        return _n_threads;
+    }
+
+  private:
+    DataSet _dataset;
+    std::vector<std::size_t> _dims;
+    std::vector<std::size_t> _chunk_dims;
+    details::ChunkFilters _filters;
+    std::size_t _n_threads;
+    T _fill_value;
+};
+
+///
+/// \brief Reads chunked datasets, decompressing the chunks on several threads
+///
+/// The chunks covered by a block are read as stored by the calling thread,
+/// with H5Dread_chunk. Their filters (shuffle and deflate) are reverted by
+/// HighFive with zlib, on a pool of threads started for each read, while the
+/// next chunks are read. The chunks are then copied to the user buffer.
+/// Chunks which were never written read as the fill value.
+///
+/// Blocks can have any position and extent. At most a few stored chunks per
+/// thread wait to be decoded, bounding the memory used. The type of the
+/// dataset must be the one of T, as no conversion is done.
+///
+/// Only available when HighFive is built with zlib (H5_USE_ZLIB) and
+/// HDF5 >= 1.10.3.
+///
+/// \code{.cpp}
+/// std::vector<float> image(4096 * 4096);
+/// ChunkReader<float>(file.getDataSet("image")).read(image.data());
+/// \endcode
+template <typename T>
+class ChunkReader {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "ChunkReader requires trivially copyable elements");
+
+  public:
+    ///
+    /// \brief Prepare reading from a chunked dataset
+    /// \param dataset The dataset, of the same type as T
+    /// \param n_threads Threads decompressing chunks, by default one per core
+    /// \exception DataSetException if the dataset isn't chunked, has
+    ///            unsupported filters or doesn't filter partial chunks
+    /// \exception DataTypeException if the type of the dataset isn't T
+    explicit ChunkReader(const DataSet& dataset, std::size_t n_threads = 0);
+
+    ///
+    /// \brief Read the whole dataset to a row-major buffer
+    void read(T* data) const;
+
+    ///
+    /// \brief Read a block to a row-major buffer
+    /// \param offset Start of the block
+    /// \param count Extent of the block
+    /// \param data Room for count elements, filled row-major
+    void read(const std::vector<std::size_t>& offset,
+              const std::vector<std::size_t>& count,
+              T* data) const;
+
+    /// \brief Extent of the chunks of the dataset
+    inline const std::vector<std::size_t>& getChunkDimensions() const noexcept {
+        return _chunk_dims;
+    }
+
+    inline std::size_t getThreadCount() const noexcept {
+        return _n_threads;
+    }
+
+  private:
+    DataSet _dataset;
+    std::vector<std::size_t> _dims;
+    std::vector<std::size_t> _chunk_dims;
+    details::ChunkFilters _filters;
+    std::size_t _n_threads;
+    T _fill_value;
+};
+
+}  // namespace HighFive
+
+#include "bits/H5DirectChunk_misc.hpp"
+
+#endif  // H5_USE_ZLIB && H5_VERSION_GE(1, 10, 3)
+
+#endif  // H5DIRECTCHUNK_HPP
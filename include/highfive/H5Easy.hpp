@@ -52,10 +52,12 @@ namespace H5Easy {
 
 using HighFive::Attribute;
 using HighFive::AtomicType;
+using HighFive::AutoChunking;
 using HighFive::Chunking;
 using HighFive::DataSet;
 using HighFive::DataSetCreateProps;
 using HighFive::DataSpace;
+using HighFive::DataType;
 using HighFive::Deflate;
 using HighFive::Exception;
 using HighFive::File;
@@ -109,6 +111,9 @@ private:
 /// - Flush::True
 /// - Compression(false)
 /// - ChunkSize: automatic.
+///
+/// With automatic chunk-size, chunks span the whole DataSet (or 10 entries per
+/// dimension for extendible DataSets), unless an AutoChunking policy is set.
 class DumpOptions
 {
 public:
@@ -118,7 +123,8 @@ public:
 
     ///
     /// \brief Constructor: overwrite (some of the) defaults.
-    /// \param Any of DumpMode, Flush, Compression in arbitrary number and order.
+    /// \param Any of DumpMode, Flush, Compression, AutoChunking in arbitrary number
+    ///        and order.
     template <class... Args>
     DumpOptions(Args... args)
     {
@@ -140,9 +146,15 @@ public:
     /// \param level Compression.
     inline void set(const Compression& level);
 
+    ///
+    /// \brief Overwrite setting.
+    /// \param policy AutoChunking, used when no chunk-size is set.
+    inline void set(const AutoChunking& policy);
+
     ///
     /// \brief Overwrite settings.
-    /// \param Any of DumpMode, Flush, Compression in arbitrary number and order.
+    /// \param Any of DumpMode, Flush, Compression, AutoChunking in arbitrary number
+    ///        and order.
     template <class T, class... Args>
     inline void set(T arg, Args... args);
 
@@ -181,11 +193,25 @@ public:
     /// \brief Get chunk size.
     inline std::vector<hsize_t> getChunkSize() const;
 
+    ///
+    /// \brief Check if chunk-size is computed with an AutoChunking policy.
+    inline bool isAutoChunked() const;
+
+    ///
+    /// \brief Get the chunk size for a DataSet, the one set or the one chosen by the
+    /// AutoChunking policy.
+    /// \param space DataSpace of the DataSet.
+    /// \param type DataType of the DataSet.
+    inline std::vector<hsize_t> getChunkSize(const DataSpace& space,
+                                             const DataType& type) const;
+
 private:
     bool m_overwrite = false;
     bool m_flush = true;
     unsigned m_compression_level = 0;
     std::vector<hsize_t> m_chunk_size = {};
+    bool m_auto_chunked = false;
+    AutoChunking m_auto_chunking;
 };
 
 ///
@@ -10,6 +10,7 @@
 #define H5FILE_HPP
 
 #include <string>
+#include <vector>
 
 #include "H5FileDriver.hpp"
 #include "H5Object.hpp"
@@ -69,6 +70,23 @@ class File : public Object,
     ///
     void flush();
 
+    ///
+    /// \brief Open a file from its image in memory, with CoreFileDriver
+    /// \param image: the bytes of an HDF5 file, as given by toImage(), copied
+    /// \param size: the size of the image in bytes
+    /// \param openFlags: ReadOnly, or ReadWrite to modify the file in memory
+    ///
+    /// Nothing is read from or written to disk.
+    static File fromImage(const void* image, size_t size, unsigned openFlags = ReadOnly);
+
+    static File fromImage(const std::vector<char>& image, unsigned openFlags = ReadOnly);
+
+    ///
+    /// \brief The bytes of the file, as it would be written to disk
+    ///
+    /// Buffers are flushed first. Works with any file driver.
+    std::vector<char> toImage() const;
+
  private:
     std::string _filename;
 };
@@ -9,6 +9,9 @@
 #ifndef H5FILEDRIVER_HPP
 #define H5FILEDRIVER_HPP
 
+#include <map>
+#include <string>
+
 #include "H5PropertyList.hpp"
 
 namespace HighFive {
@@ -18,6 +21,59 @@ namespace HighFive {
 ///
 class FileDriver : public FileAccessProps {};
 
+#ifdef H5_HAVE_PARALLEL
+
+///
+/// \brief MPI-IO hints, tuning how MPI-IO accesses the file
+///
+/// Hints unknown to the MPI implementation are ignored by it. The setters
+/// cover the collective buffering (two-phase I/O) of ROMIO and the striping
+/// of new files on parallel filesystems such as Lustre.
+///
+/// \code{.cpp}
+/// MPIOHints hints;
+/// hints.setCollectiveBufferingNodes(16)
+///      .setCollectiveBufferSize(16 * 1024 * 1024)
+///      .setCollectiveBufferingWrite(MPIOHints::Toggle::Enable)
+///      .setStripingFactor(16);
+/// File file("out.h5", File::Create, MPIOFileDriver(MPI_COMM_WORLD, hints));
+/// \endcode
+class MPIOHints {
+  public:
+    enum class Toggle { Automatic, Enable, Disable };
+
+    /// \brief Number of aggregators of collective I/O, cb_nodes
+    MPIOHints& setCollectiveBufferingNodes(int n_nodes);
+
+    /// \brief Buffer of each aggregator in bytes, cb_buffer_size
+    MPIOHints& setCollectiveBufferSize(size_t size);
+
+    /// \brief Collective buffering of writes, romio_cb_write
+    MPIOHints& setCollectiveBufferingWrite(Toggle toggle);
+
+    /// \brief Collective buffering of reads, romio_cb_read
+    MPIOHints& setCollectiveBufferingRead(Toggle toggle);
+
+    /// \brief Number of storage targets of a new file, striping_factor
+    MPIOHints& setStripingFactor(int n_targets);
+
+    /// \brief Bytes stored on a target before moving to the next one,
+    /// striping_unit
+    MPIOHints& setStripingUnit(size_t size);
+
+    /// \brief Any other hint
+    MPIOHints& set(const std::string& key, const std::string& value);
+
+    const std::map<std::string, std::string>& getHints() const noexcept {
+        return _hints;
+    }
+
+  private:
+    std::map<std::string, std::string> _hints;
+};
+
+#endif  // H5_HAVE_PARALLEL
+
 ///
 /// \brief MPIIO Driver for Parallel HDF5
 ///
@@ -26,7 +82,71 @@ class MPIOFileDriver : public FileDriver {
     template <typename Comm, typename Info>
     inline MPIOFileDriver(Comm mpi_comm, Info mpi_info);
 
+#ifdef H5_HAVE_PARALLEL
+    ///
+    /// \brief Open the file with MPI-IO hints
+    MPIOFileDriver(MPI_Comm mpi_comm, const MPIOHints& hints);
+#endif
+
+  private:
+};
+
+#ifdef H5_HAVE_PARALLEL
+
+///
+/// \brief Collective metadata reads, for files opened with MPIOFileDriver
+///
+/// By default every rank reads the metadata it needs on its own, so that
+/// thousands of ranks opening the same objects flood the filesystem. With
+/// collective metadata reads, one rank reads and broadcasts them: every
+/// operation reading metadata (opening objects, getting their dimensions,
+/// attributes...) must then be done by all the ranks.
+///
+/// \code{.cpp}
+/// MPIOFileDriver driver(MPI_COMM_WORLD, MPI_INFO_NULL);
+/// driver.add(MPIOCollectiveMetadataRead());
+/// driver.add(MPIOCollectiveMetadataWrite());
+/// \endcode
+class MPIOCollectiveMetadataRead {
+  public:
+    explicit MPIOCollectiveMetadataRead(bool enable = true)
+        : _enable(enable) {}
+
   private:
+    friend FileAccessProps;
+    void apply(hid_t hid) const;
+    const bool _enable;
+};
+
+///
+/// \brief Collective metadata writes, for files opened with MPIOFileDriver
+///
+/// The metadata cache is flushed with a single collective write instead of
+/// independent writes by each rank.
+class MPIOCollectiveMetadataWrite {
+  public:
+    explicit MPIOCollectiveMetadataWrite(bool enable = true)
+        : _enable(enable) {}
+
+  private:
+    friend FileAccessProps;
+    void apply(hid_t hid) const;
+    const bool _enable;
+};
+
+#endif  // H5_HAVE_PARALLEL
+
+///
+/// \brief In-memory driver: the whole file is held in memory
+///
+/// The file is written to disk when closed only if \p backingStore is set,
+/// otherwise it vanishes with its last handle, without any filesystem access.
+/// See also File::fromImage and File::toImage.
+class CoreFileDriver : public FileDriver {
+  public:
+    /// \param increment Bytes by which the memory of the file grows
+    /// \param backingStore Whether to write the file to disk when closed
+    explicit CoreFileDriver(size_t increment = 1024 * 1024, bool backingStore = false);
 };
 
 }  // namespace HighFive
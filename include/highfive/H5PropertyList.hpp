@@ -9,10 +9,16 @@
 #ifndef H5PROPERTY_LIST_HPP
 #define H5PROPERTY_LIST_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include <H5Ppublic.h>
 
+#include "H5DataSpace.hpp"
+#include "H5DataType.hpp"
 #include "H5Exception.hpp"
 #include "H5Object.hpp"
 
@@ -87,16 +93,91 @@ typedef PropertyList<PropertyType::DATASET_XFER> DataTransferProps;
 template <PropertyType T>
 class RawPropertyList : public PropertyList<T> {
   public:
+    RawPropertyList() = default;
+
+    ///
+    /// \brief Start from a copy of the properties of another list
+    explicit RawPropertyList(const PropertyList<T>& other);
+
     template <typename F, typename... Args>
     void add(const F& funct, const Args&... args);
 };
 
 
+///
+/// \brief Policy choosing the shape of chunks from the shape of a dataset
+///
+/// Chunks hold about getChunkBytes() bytes, the default matching the size of
+/// the default chunk cache, so that a partial read only decompresses the
+/// chunks it covers. Without access axis, chunks are as close as possible to
+/// hypercubes clipped to the dataset. With one, they extend along this axis
+/// first: use the axis along which the data is read contiguously, e.g. 0 for
+/// time series stored as (time, channel) and read channel by channel.
+///
+/// Unlimited dimensions aren't bounded by their current extent, so chunks of
+/// a dataset growing from few rows still have a useful size.
+///
+/// \code{.cpp}
+/// DataSpace space({100000, 64}, {DataSpace::UNLIMITED, 64});
+/// DataSetCreateProps props;
+/// props.add(Chunking(space, AtomicType<float>(), AutoChunking().setAccessAxis(0)));
+/// \endcode
+class AutoChunking {
+  public:
+    static const std::size_t DefaultChunkBytes = 1024 * 1024;
+    static const std::size_t NoAxis = static_cast<std::size_t>(-1);
+
+    explicit AutoChunking(std::size_t chunk_bytes = DefaultChunkBytes,
+                          std::size_t access_axis = NoAxis)
+        : _chunk_bytes(chunk_bytes)
+        , _access_axis(access_axis) {}
+
+    AutoChunking& setChunkBytes(std::size_t chunk_bytes) noexcept {
+        _chunk_bytes = chunk_bytes;
+        return *this;
+    }
+
+    AutoChunking& setAccessAxis(std::size_t axis) noexcept {
+        _access_axis = axis;
+        return *this;
+    }
+
+    std::size_t getChunkBytes() const noexcept {
+        return _chunk_bytes;
+    }
+
+    std::size_t getAccessAxis() const noexcept {
+        return _access_axis;
+    }
+
+    ///
+    /// \brief Compute the chunk dimensions of a dataset
+    /// \param dims Current dimensions of the dataset, of rank >= 1
+    /// \param max_dims Maximum dimensions, possibly DataSpace::UNLIMITED.
+    ///        Empty when equal to dims.
+    /// \param element_size Size of an element in bytes
+    std::vector<hsize_t> getDimensions(const std::vector<size_t>& dims,
+                                       const std::vector<size_t>& max_dims,
+                                       std::size_t element_size) const;
+
+  private:
+    std::size_t _chunk_bytes;
+    std::size_t _access_axis;
+};
+
 class Chunking {
   public:
     explicit Chunking(const std::vector<hsize_t>& dims)
         : _dims(dims) {}
 
+    ///
+    /// \brief Chunks chosen by an AutoChunking policy
+    /// \param space Dataspace of the dataset, with its maximum dimensions
+    /// \param type Datatype of the dataset
+    Chunking(const DataSpace& space,
+             const DataType& type,
+             const AutoChunking& policy = AutoChunking());
+
     Chunking(const std::initializer_list<hsize_t>& items)
         : Chunking(std::vector<hsize_t>{items}) {}
 
@@ -134,10 +215,139 @@ class Shuffle {
     void apply(hid_t hid) const;
 };
 
+///
+/// \brief Size of the buffers used for type conversions and to gather or
+/// scatter non-contiguous selections
+///
+/// HDF5 converts data by pieces of 1 MiB by default: raising it lets reads
+/// and writes which convert types, or go through a fragmented memory space,
+/// be done in fewer and larger passes.
+///
+/// \code{.cpp}
+/// DataTransferProps xfer_props;
+/// xfer_props.add(ConversionBuffer(64 * 1024 * 1024));
+/// dataset.read(values, xfer_props);
+/// \endcode
+class ConversionBuffer {
+  public:
+    explicit ConversionBuffer(size_t size)
+        : _size(size) {}
+
+  private:
+    friend DataTransferProps;
+    void apply(hid_t hid) const;
+    const size_t _size;
+};
+
+///
+/// \brief Number of I/O vectors built at once for hyperslab selections
+///
+/// Selections made of many small hyperslabs are read or written by batches
+/// of this many contiguous pieces, 1024 by default.
+class HyperVectorSize {
+  public:
+    explicit HyperVectorSize(size_t size)
+        : _size(size) {}
+
+  private:
+    friend DataTransferProps;
+    void apply(hid_t hid) const;
+    const size_t _size;
+};
+
+///
+/// \brief Algebraic expression applied to the values on transfer
+///
+/// The expression, e.g. "2*x+1", is applied to each element read from the
+/// file, or written to it. Only for numeric types.
+class DataTransform {
+  public:
+    explicit DataTransform(const std::string& expression)
+        : _expression(expression) {}
+
+  private:
+    friend DataTransferProps;
+    void apply(hid_t hid) const;
+    const std::string _expression;
+};
+
+#ifdef H5_HAVE_PARALLEL
+
+///
+/// \brief Collective or independent MPI-IO transfers, for files opened with
+/// MPIOFileDriver
+///
+/// Collective transfers let MPI-IO aggregate the accesses of all the ranks
+/// (two-phase I/O), which is much faster on parallel filesystems than each
+/// rank accessing the file on its own. All the ranks of the communicator
+/// must then take part in every read and write, possibly with an empty
+/// selection. HDF5 may still fall back to independent I/O, see
+/// getMpioActualIOMode.
+///
+/// \code{.cpp}
+/// DataTransferProps xfer_props;
+/// xfer_props.add(UseCollectiveIO());
+/// dataset.select(offset, count).write(values, xfer_props);
+/// \endcode
+class UseCollectiveIO {
+  public:
+    explicit UseCollectiveIO(bool enable = true)
+        : _enable(enable) {}
+
+  private:
+    friend DataTransferProps;
+    void apply(hid_t hid) const;
+    const bool _enable;
+};
+
+///
+/// \brief I/O actually done by the last read or write of a transfer
+/// property list
+enum class MpioIOMode {
+    /// Independent I/O, e.g. after a fall back from collective I/O
+    NoCollective,
+    /// Independent I/O on the chunks of a chunked dataset
+    ChunkIndependent,
+    /// Collective I/O on the chunks of a chunked dataset
+    ChunkCollective,
+    /// Collective I/O on some of the chunks, independent on others
+    ChunkMixed,
+    /// Collective I/O on a contiguous dataset
+    ContiguousCollective
+};
+
+///
+/// \brief Mode of the I/O done by the last read or write with \p xfer_props,
+/// to detect collective transfers silently done independently
+/// \exception PropertyException if \p xfer_props is the default list
+MpioIOMode getMpioActualIOMode(const DataTransferProps& xfer_props);
+
+///
+/// \brief Reasons why the last read or write with \p xfer_props wasn't
+/// collective, as bit masks of H5D_mpio_no_collective_cause_t: for this rank
+/// and for any rank. Both are H5D_MPIO_COLLECTIVE when it was.
+std::pair<uint32_t, uint32_t> getMpioNoCollectiveCause(const DataTransferProps& xfer_props);
+
+#endif  // H5_HAVE_PARALLEL
+
+///
+/// \brief Expected order of the accesses to a chunked dataset
+enum class CacheAccess {
+    /// Rows (along the first dimension) one after the other
+    RowSweep,
+    /// Columns (along the last dimension) one after the other
+    ColumnSweep,
+    /// No particular order
+    Random
+};
+
 /// Dataset access property to control chunk cache configuration.
 /// Do not confuse with the similar file access property for H5Pset_cache
 class Caching {
   public:
+    /// \brief Upper bound of the cache sized for an access pattern
+    static const size_t DefaultMaxBytes = 64 * 1024 * 1024;
+
     /// https://support.hdfgroup.org/HDF5/doc/RM/H5P/H5Pset_chunk_cache.html for
     /// details.
     Caching(const size_t numSlots,
@@ -147,7 +357,52 @@ class Caching {
         , _cacheSize(cacheSize)
         , _w0(w0) {}
 
+    ///
+    /// \brief Size the chunk cache for an access pattern
+    ///
+    /// A sweep keeps the chunks of a whole row, or column, of chunks so that
+    /// each chunk is read once; random accesses get as many chunks as fit in
+    /// \p maxBytes. The cache always holds at least one chunk, even above
+    /// \p maxBytes, and has about 100 slots per chunk.
+    /// \param dims Dimensions of the dataset
+    /// \param chunkDims Dimensions of its chunks
+    /// \param elementSize Size of an element in bytes
+    /// \param access Expected access pattern
+    /// \param maxBytes Upper bound of the size of the cache
+    Caching(const std::vector<size_t>& dims,
+            const std::vector<size_t>& chunkDims,
+            size_t elementSize,
+            CacheAccess access,
+            size_t maxBytes = DefaultMaxBytes);
+
+    ///
+    /// \brief Size the chunk cache of an open dataset for an access pattern.
+    /// The dataset is to be reopened with these access properties once all
+    /// its handles are closed: HDF5 sets up the cache on the first opening.
+    /// \exception PropertyException if the dataset isn't chunked
+    Caching(const DataSet& dataset,
+            CacheAccess access,
+            size_t maxBytes = DefaultMaxBytes);
+
+    size_t getSlotCount() const noexcept {
+        return _numSlots;
+    }
+
+    size_t getCacheSize() const noexcept {
+        return _cacheSize;
+    }
+
+    double getW0() const noexcept {
+        return _w0;
+    }
+
   private:
+    static Caching forAccess(const std::vector<size_t>& dims,
+                             const std::vector<size_t>& chunkDims,
+                             size_t elementSize,
+                             CacheAccess access,
+                             size_t maxBytes);
+
     friend DataSetAccessProps;
     void apply(hid_t hid) const;
     const size_t _numSlots;
@@ -47,6 +47,25 @@ class Selection : public SliceTraits<Selection> {
     /// \return return the datatype of the selection
     const DataType getDataType() const;
 
+    ///
+    /// \brief Move the selected elements by \p offset, in every dimension
+    ///
+    /// The selection is moved in place, without creating dataspaces, so that
+    /// a window can slide over a dataset at no cost. Copies of the selection
+    /// are not moved.
+    /// \exception DataSpaceException if the elements would leave the dataset;
+    ///            the selection is then unchanged
+    Selection& shift(const std::vector<std::ptrdiff_t>& offset);
+
+    ///
+    /// \brief Move the selected elements to \p offset from where they were
+    /// selected
+    Selection& setOffset(const std::vector<std::ptrdiff_t>& offset);
+
+    ///
+    /// \brief Offset of the selected elements from where they were selected
+    std::vector<std::ptrdiff_t> getOffset() const;
+
   private:
     Selection(const DataSpace& memspace,
               const DataSpace& file_space,
@@ -54,8 +73,14 @@ class Selection : public SliceTraits<Selection> {
 
     DataSpace _mem_space, _file_space;
     DataSet _set;
+    // Column selected at each position of the memory space, as an index in
+    // the increasing columns of the file space. Empty when in file order.
+    std::vector<size_t> _column_order;
+    // Empty until moved
+    std::vector<std::ptrdiff_t> _offset;
 
     template <typename Derivate> friend class ::HighFive::SliceTraits;
+    friend const std::vector<size_t>& details::get_column_order(const Selection&);
     // absolute namespace naming due to GCC bug 52625
 };
 
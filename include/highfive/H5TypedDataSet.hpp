@@ -0,0 +1,173 @@
+/*
+ *  Copyright (c), 2020, Blue Brain Project - EPFL
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#ifndef H5TYPEDDATASET_HPP
+#define H5TYPEDDATASET_HPP
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "H5DataSet.hpp"
+#include "H5DataSpace.hpp"
+
+namespace HighFive {
+
+template <typename T, std::size_t N>
+class TypedSelection;
+
+///
+/// \brief A DataSet handle with a static element type and rank
+///
+/// The rank and the element type of the dataset are checked once, when the
+/// handle is created: the type must have the class, size and sign of T, so
+/// that HDF5 has no conversion to do, but byte swapping. Reads and writes
+/// then go straight to H5Dread/H5Dwrite, from/to contiguous row-major
+/// buffers of T, without any dimension or type check. Block transfers select
+/// the block in spaces of their own, so a handle can be shared by several
+/// threads. To transfer blocks of a same extent repeatedly, select() one and
+/// move it with TypedSelection::setOffset, which creates no dataspace.
+///
+/// \code{.cpp}
+/// TypedDataSet<double, 2> matrix(file.getDataSet("matrix"));
+/// std::array<double, 16> block;
+/// TypedSelection<double, 2> window = matrix.select({0, 0}, {4, 4});
+/// for (size_t i = 0; i < matrix.getDimensions()[0]; i += 4) {
+///     window.setOffset({i, 0}).read(block.data());
+/// }
+/// \endcode
+template <typename T, std::size_t N>
+class TypedDataSet {
+    static_assert(N > 0, "TypedDataSet requires a rank of at least 1");
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "TypedDataSet requires trivially copyable elements");
+
+  public:
+    using value_type = T;
+    using extent_type = std::array<std::size_t, N>;
+
+    ///
+    /// \brief Wrap a dataset, checking its rank and element type
+    /// \exception DataSetException if the rank of the dataset isn't N
+    /// \exception DataTypeException if its elements aren't of the class, size
+    ///            and sign of T
+    explicit TypedDataSet(const DataSet& dataset);
+
+    inline const DataSet& getDataSet() const noexcept {
+        return _dataset;
+    }
+
+    inline const extent_type& getDimensions() const noexcept {
+        return _dims;
+    }
+
+    std::size_t getElementCount() const noexcept;
+
+    ///
+    /// \brief Read the whole dataset into a buffer of getElementCount() elements
+    void read(T* buffer) const;
+
+    ///
+    /// \brief Read the block of extent \p count at \p offset into a buffer
+    /// of the size of the block
+    ///
+    /// The block is selected in new dataspaces at each call, see select() to
+    /// avoid it.
+    void read(const extent_type& offset, const extent_type& count, T* buffer) const;
+
+    void write(const T* buffer);
+
+    void write(const extent_type& offset, const extent_type& count, const T* buffer);
+
+    ///
+    /// \brief Select a block, to be transferred repeatedly
+    TypedSelection<T, N> select(const extent_type& offset,
+                                const extent_type& count) const;
+
+    ///
+    /// \brief Change the size of the dataset, see DataSet::resize
+    void resize(const extent_type& dims);
+
+  private:
+    // Select the block in a copy of _file_space, returned with the matching
+    // memory space
+    std::pair<DataSpace, DataSpace> selectBlock(const extent_type& offset,
+                                                const extent_type& count) const;
+
+    DataSet _dataset;
+    extent_type _dims;
+    // Space of the dataset, never selected in place
+    DataSpace _file_space;
+};
+
+
+///
+/// \brief A block selection of a TypedDataSet
+///
+/// Selecting is done once, transfers from/to the selection are then a
+/// single call to H5Dread/H5Dwrite. The block can be moved over the dataset
+/// with setOffset, selecting it again in the dataspace of the selection: a
+/// selection moved that way must not be shared by several threads.
+template <typename T, std::size_t N>
+class TypedSelection {
+  public:
+    using value_type = T;
+    using extent_type = std::array<std::size_t, N>;
+
+    inline const DataSet& getDataSet() const noexcept {
+        return _dataset;
+    }
+
+    /// \brief The extent of the selected block
+    inline const extent_type& getDimensions() const noexcept {
+        return _dims;
+    }
+
+    /// \brief The position of the selected block in the dataset
+    inline const extent_type& getOffset() const noexcept {
+        return _offset;
+    }
+
+    std::size_t getElementCount() const noexcept;
+
+    ///
+    /// \brief Move the selected block to \p offset in the dataset
+    ///
+    /// The block is selected again in place, without creating dataspaces.
+    /// Copies of the selection are not moved.
+    /// \exception DataSpaceException if the block would leave the dataset;
+    ///            the selection is then unchanged
+    TypedSelection& setOffset(const extent_type& offset);
+
+    ///
+    /// \brief Read the selection into a buffer of getElementCount() elements
+    void read(T* buffer) const;
+
+    void write(const T* buffer);
+
+  private:
+    TypedSelection(const DataSet& dataset, const DataSpace& file_space,
+                   const extent_type& dataset_dims, const extent_type& offset,
+                   const extent_type& count);
+
+    DataSet _dataset;
+    DataSpace _file_space;
+    DataSpace _mem_space;
+    extent_type _dataset_dims;
+    extent_type _offset;
+    extent_type _dims;
+
+    friend class TypedDataSet<T, N>;
+};
+
+}  // namespace HighFive
+
+#include "bits/H5TypedDataSet_misc.hpp"
+
+#endif  // H5TYPEDDATASET_HPP
@@ -10,6 +10,10 @@
 #ifndef H5UTILITY_HPP
 #define H5UTILITY_HPP
 
+#include <memory>
+#include <type_traits>
+#include <utility>
+
 #include <H5Epublic.h>
 
 namespace HighFive {
@@ -35,6 +39,39 @@ private:
     void* _client_data;
 };
 
+///
+/// \brief Allocator adaptor default-initializing (i.e. not zeroing) trivial types
+///
+/// Containers using it skip the memset done by `resize()`, which is wasted
+/// when their content is about to be entirely overwritten by a read.
+///
+/// \code{.cpp}
+/// std::vector<double, HighFive::DefaultInitAllocator<double>> values;
+/// dataset.read(values);  // memory is only touched by HDF5
+/// \endcode
+template <typename T, typename Allocator = std::allocator<T>>
+class DefaultInitAllocator : public Allocator {
+    using traits = std::allocator_traits<Allocator>;
+
+  public:
+    template <typename U>
+    struct rebind {
+        using other = DefaultInitAllocator<U, typename traits::template rebind_alloc<U>>;
+    };
+
+    using Allocator::Allocator;
+
+    template <typename U>
+    void construct(U* ptr) noexcept(std::is_nothrow_default_constructible<U>::value) {
+        ::new (static_cast<void*>(ptr)) U;
+    }
+
+    template <typename U, typename... Args>
+    void construct(U* ptr, Args&&... args) {
+        traits::construct(static_cast<Allocator&>(*this), ptr, std::forward<Args>(args)...);
+    }
+};
+
 }  // namespace HighFive
 
 #endif // H5UTIL_HPP
@@ -0,0 +1,120 @@
+/*
+ *  Copyright (c), 2020, Blue Brain Project - EPFL
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#ifndef H5ARRAYVIEW_MISC_HPP
+#define H5ARRAYVIEW_MISC_HPP
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+#include <H5Spublic.h>
+
+namespace HighFive {
+
+template <typename T, std::size_t N>
+inline ArrayView<T, N>::ArrayView(T* ptr, const std::array<std::size_t, N>& dims)
+    : _data(ptr)
+    , _dims(dims) {
+    std::size_t stride = 1;
+    for (std::size_t i = N; i > 0; --i) {
+        _strides[i - 1] = stride;
+        stride *= _dims[i - 1];
+    }
+}
+
+template <typename T, std::size_t N>
+inline ArrayView<T, N>::ArrayView(T* ptr,
+                                  const std::array<std::size_t, N>& dims,
+                                  const std::array<std::size_t, N>& strides)
+    : _data(ptr)
+    , _dims(dims)
+    , _strides(strides) {}
+
+template <typename T, std::size_t N>
+inline std::size_t ArrayView<T, N>::getElementCount() const noexcept {
+    return std::accumulate(_dims.begin(), _dims.end(), std::size_t{1u},
+                           std::multiplies<std::size_t>());
+}
+
+template <typename T, std::size_t N>
+inline DataSpace ArrayView<T, N>::getMemSpace() const {
+    static_assert(N > 0, "ArrayView must have at least one dimension");
+
+    if (getElementCount() == 0) {
+        return DataSpace(_dims.begin(), _dims.end());
+    }
+
+    // Try to describe the view as a single hyperslab of an N-dim dense array
+    // `mem_dims`. Strides of dimensions with a single element are irrelevant
+    // and replaced by the tightest valid ones.
+    std::vector<hsize_t> mem_dims(N), offset(N, 0), stride(N, 1), count(_dims.begin(), _dims.end());
+    std::vector<std::size_t> strides(_strides.begin(), _strides.end());
+    bool single_hyperslab = true;
+
+    if (_dims[N - 1] > 1 && strides[N - 1] == 0) {
+        throw DataSpaceException("ArrayView strides must be positive");
+    }
+    strides[N - 1] = (_dims[N - 1] > 1) ? strides[N - 1] : 1;
+    stride[N - 1] = strides[N - 1];
+    std::size_t inner_size = 1;  // elements in a step of dimension i + 1
+    std::size_t span = (_dims[N - 1] - 1) * strides[N - 1] + 1;
+
+    for (std::size_t i = N - 1; i > 0; --i) {
+        std::size_t& step = strides[i - 1];
+        if (_dims[i - 1] == 1) {
+            step = (span + inner_size - 1) / inner_size * inner_size;
+        } else if (step < span) {
+            throw DataSpaceException("ArrayView strides must describe a row-major layout");
+        }
+        if (step % inner_size != 0) {
+            single_hyperslab = false;
+        }
+        mem_dims[i] = step / inner_size;
+        inner_size = step;
+        span += (_dims[i - 1] - 1) * step;
+    }
+    mem_dims[0] = (N > 1) ? _dims[0] : span;
+
+    if (single_hyperslab) {
+        DataSpace space(mem_dims.begin(), mem_dims.end());
+        if (H5Sselect_hyperslab(space.getId(), H5S_SELECT_SET, offset.data(),
+                                stride.data(), count.data(), NULL) < 0) {
+            HDF5ErrMapper::ToException<DataSpaceException>("Unable to select hyperslap");
+        }
+        return space;
+    }
+
+    // Otherwise flatten the buffer and select it row by row (last dimension).
+    // Rows don't overlap and are in increasing order, thus keeping the order
+    // of the view elements.
+    DataSpace space{span};
+    H5Sselect_none(space.getId());
+    const hsize_t row_stride = strides[N - 1];
+    const hsize_t row_count = _dims[N - 1];
+    std::vector<std::size_t> index(N - 1, 0);
+    for (std::size_t row = 0; row < getElementCount() / _dims[N - 1]; ++row) {
+        hsize_t row_offset = 0;
+        for (std::size_t i = 0; i < N - 1; ++i) {
+            row_offset += index[i] * strides[i];
+        }
+        if (H5Sselect_hyperslab(space.getId(), H5S_SELECT_OR, &row_offset,
+                                &row_stride, &row_count, NULL) < 0) {
+            HDF5ErrMapper::ToException<DataSpaceException>("Unable to select hyperslap");
+        }
+        for (std::size_t i = N - 1; i > 0 && ++index[i - 1] == _dims[i - 1]; --i) {
+            index[i - 1] = 0;
+        }
+    }
+    return space;
+}
+
+}  // namespace HighFive
+
+#endif  // H5ARRAYVIEW_MISC_HPP
@@ -71,7 +71,7 @@ inline void Attribute::read(T& array) const {
         throw DataSpaceException(ss.str());
     }
 
-    const DataType mem_datatype = create_and_check_datatype<element_type>();
+    const DataType& mem_datatype = details::cached_checked_datatype<element_type>();
 
     // Apply pre read conversions
     details::data_converter<T> converter(mem_space);
@@ -93,7 +93,7 @@ inline void Attribute::read(T* array) const {
     using element_type = typename details::type_of_array<T>::type;
     DataSpace mem_space = getMemSpace();
 
-    const DataType mem_datatype = create_and_check_datatype<element_type>();
+    const DataType& mem_datatype = details::cached_checked_datatype<element_type>();
 
     if (H5Aread(getId(), mem_datatype.getId(),
                 static_cast<void*>(array)) < 0) {
@@ -117,7 +117,7 @@ inline void Attribute::write(const T& buffer) {
         throw DataSpaceException(ss.str());
     }
 
-    const DataType mem_datatype = create_and_check_datatype<element_type>();
+    const DataType& mem_datatype = details::cached_checked_datatype<element_type>();
     details::data_converter<T> converter(mem_space);
 
     if (H5Awrite(getId(), mem_datatype.getId(),
@@ -132,7 +132,7 @@ inline void Attribute::write_raw(const T& buffer) {
     using element_type = typename details::type_of_array<T>::type;
     DataSpace space = getSpace();
     DataSpace mem_space = getMemSpace();
-    const DataType mem_datatype = create_and_check_datatype<element_type>();
+    const DataType& mem_datatype = details::cached_checked_datatype<element_type>();
     details::data_converter<T> converter(mem_space);
 
     if (H5Awrite(getId(), mem_datatype.getId(),
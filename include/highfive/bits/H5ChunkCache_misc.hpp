@@ -0,0 +1,173 @@
+/*
+ *  Copyright (c), 2020, Blue Brain Project - EPFL
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#ifndef H5CHUNKCACHE_MISC_HPP
+#define H5CHUNKCACHE_MISC_HPP
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <H5Spublic.h>
+
+#include "../H5DataSpace.hpp"
+
+namespace HighFive {
+
+namespace details {
+
+///
+/// \brief Model of the chunk cache of a dataset, counting hits and misses
+///
+/// HDF5 doesn't report the activity of its chunk caches, so accesses are
+/// replayed on a model of it: chunks are mapped to slots like HDF5 does, a
+/// chunk evicting the one in its slot, and the least recently used chunks
+/// are evicted when the cache is full. Chunks larger than the cache bypass it.
+class ChunkCacheModel {
+  public:
+    ChunkCacheModel(const std::vector<size_t>& chunk_dims,
+                    std::size_t chunk_bytes,
+                    std::size_t n_slots,
+                    std::size_t cache_bytes)
+        : _chunk_dims(chunk_dims)
+        , _capacity(chunk_bytes <= cache_bytes ? cache_bytes / chunk_bytes : 0)
+        , _n_slots(std::max(n_slots, std::size_t{1})) {}
+
+    ///
+    /// \brief Record an access to the chunks selected in a file space
+    void access(const DataSpace& file_space) {
+        const hid_t space_id = file_space.getId();
+        if (H5Sget_select_npoints(space_id) <= 0) {
+            return;
+        }
+        const std::size_t rank = _chunk_dims.size();
+        std::vector<hsize_t> start(rank), end(rank);
+        if (H5Sget_select_bounds(space_id, start.data(), end.data()) < 0) {
+            HDF5ErrMapper::ToException<DataSpaceException>(
+                "Unable to get the bounds of the selection");
+        }
+        std::vector<std::size_t> dims = file_space.getDimensions();
+        std::vector<unsigned> encode_bits(rank, 0);
+        for (std::size_t i = 0; i < rank; ++i) {
+            const std::size_t n_chunks = (dims[i] + _chunk_dims[i] - 1) / _chunk_dims[i];
+            while ((std::size_t{1} << encode_bits[i]) < n_chunks) {
+                ++encode_bits[i];
+            }
+        }
+
+        // Chunks of the bounding box, in row-major order
+        std::vector<std::size_t> first(rank), last(rank), chunk(rank);
+        for (std::size_t i = 0; i < rank; ++i) {
+            first[i] = static_cast<std::size_t>(start[i]) / _chunk_dims[i];
+            last[i] = static_cast<std::size_t>(end[i]) / _chunk_dims[i];
+        }
+        chunk = first;
+        std::lock_guard<std::mutex> lock(_mutex);
+        while (true) {
+            if (intersects(space_id, chunk)) {
+                touch(chunk, encode_bits);
+            }
+            std::size_t i = rank;
+            while (i-- > 0) {
+                if (++chunk[i] <= last[i]) {
+                    break;
+                }
+                chunk[i] = first[i];
+            }
+            if (i == std::size_t(-1)) {
+                return;
+            }
+        }
+    }
+
+    std::pair<std::size_t, std::size_t> getCounts() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return {_hits, _misses};
+    }
+
+  private:
+    using Chunk = std::vector<std::size_t>;
+
+    bool intersects(hid_t space_id, const Chunk& chunk) const {
+#if H5_VERSION_GE(1, 10, 7)
+        std::vector<hsize_t> start(chunk.size()), end(chunk.size());
+        for (std::size_t i = 0; i < chunk.size(); ++i) {
+            start[i] = chunk[i] * _chunk_dims[i];
+            end[i] = start[i] + _chunk_dims[i] - 1;
+        }
+        return H5Sselect_intersect_block(space_id, start.data(), end.data()) > 0;
+#else
+        (void) space_id;
+        (void) chunk;
+        return true;
+#endif
+    }
+
+    // Hash of HDF5, shifting the coordinates by the bits needed to
+    // encode the chunks along each dimension
+    std::size_t getSlot(const Chunk& chunk, const std::vector<unsigned>& encode_bits) const {
+        std::size_t value = chunk[0];
+        for (std::size_t i = 1; i < chunk.size(); ++i) {
+            value = (value << encode_bits[i]) ^ chunk[i];
+        }
+        return value % _n_slots;
+    }
+
+    void touch(const Chunk& chunk, const std::vector<unsigned>& encode_bits) {
+        const auto cached = _cached.find(chunk);
+        if (cached != _cached.end()) {
+            ++_hits;
+            _lru.splice(_lru.begin(), _lru, cached->second.first);
+            return;
+        }
+        ++_misses;
+        if (_capacity == 0) {
+            return;
+        }
+        const std::size_t slot = getSlot(chunk, encode_bits);
+        const auto occupant = _slots.find(slot);
+        if (occupant != _slots.end()) {
+            evict(occupant->second);
+        }
+        if (_cached.size() == _capacity) {
+            evict(_lru.back());
+        }
+        _lru.push_front(chunk);
+        _cached.emplace(chunk, std::make_pair(_lru.begin(), slot));
+        _slots[slot] = chunk;
+    }
+
+    void evict(const Chunk& chunk) {
+        const auto cached = _cached.find(chunk);
+        const Chunk evicted = chunk;  // chunk may refer to the removed elements
+        _slots.erase(cached->second.second);
+        _lru.erase(cached->second.first);
+        _cached.erase(evicted);
+    }
+
+    const std::vector<size_t> _chunk_dims;
+    const std::size_t _capacity;  // in chunks
+    const std::size_t _n_slots;
+
+    mutable std::mutex _mutex;
+    std::list<Chunk> _lru;
+    std::map<Chunk, std::pair<std::list<Chunk>::iterator, std::size_t>> _cached;
+    std::unordered_map<std::size_t, Chunk> _slots;
+    std::size_t _hits = 0;
+    std::size_t _misses = 0;
+};
+
+}  // namespace details
+
+}  // namespace HighFive
+
+#endif  // H5CHUNKCACHE_MISC_HPP
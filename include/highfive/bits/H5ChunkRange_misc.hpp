@@ -0,0 +1,164 @@
+/*
+ *  Copyright (c), 2020, Blue Brain Project - EPFL
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#ifndef H5CHUNKRANGE_MISC_HPP
+#define H5CHUNKRANGE_MISC_HPP
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+#include <H5Dpublic.h>
+
+#include "../H5ChunkRange.hpp"
+#include "../H5Selection.hpp"
+#include "H5DataSet_misc.hpp"
+
+namespace HighFive {
+
+namespace details {
+
+// Rows read at once from datasets which aren't chunked
+static constexpr size_t unchunked_block_bytes = 1024 * 1024;
+
+}  // namespace details
+
+template <typename T>
+inline ChunkRange<T> DataSet::chunks(bool prefetch) const {
+    return ChunkRange<T>(*this, prefetch);
+}
+
+template <typename T>
+inline ChunkRange<T>::ChunkRange(const DataSet& dataset, bool prefetch)
+    : _dataset(dataset)
+    , _dims(dataset.getDimensions())
+    , _block_dims(details::get_chunk_dims(dataset))
+    , _n_blocks(1)
+#ifdef H5_HAVE_THREADSAFE
+    , _prefetch(prefetch)
+#else
+    , _prefetch(false)
+#endif
+    , _index(0) {
+    (void) prefetch;
+    if (_dims.empty()) {
+        throw DataSetException("Impossible to iterate over the chunks of a scalar DataSet");
+    }
+    const bool chunked = _block_dims.size() == _dims.size();
+    if (!chunked) {
+        _block_dims.resize(_dims.size());
+        for (size_t i = 1; i < _dims.size(); ++i) {
+            _block_dims[i] = std::max(_dims[i], size_t{1});
+        }
+        const size_t row_bytes = std::accumulate(_dims.begin() + 1, _dims.end(), sizeof(T),
+                                                 std::multiplies<size_t>());
+        _block_dims[0] = std::max(details::unchunked_block_bytes / std::max(row_bytes, size_t{1}),
+                                  size_t{1});
+    }
+    for (size_t i = 0; i < _dims.size(); ++i) {
+        _n_blocks *= (_dims[i] + _block_dims[i] - 1) / _block_dims[i];
+    }
+    if (chunked) {
+        sortByAddress();
+    }
+}
+
+template <typename T>
+inline void ChunkRange<T>::getOffset(size_t index, std::vector<size_t>& offset) const {
+    offset.resize(_dims.size());
+    // Position in the grid of blocks, last dimension varying fastest
+    for (size_t i = _dims.size(); i-- > 0;) {
+        const size_t n_blocks = (_dims[i] + _block_dims[i] - 1) / _block_dims[i];
+        offset[i] = (index % n_blocks) * _block_dims[i];
+        index /= n_blocks;
+    }
+}
+
+template <typename T>
+inline void ChunkRange<T>::sortByAddress() {
+#if H5_VERSION_GE(1, 10, 5)
+    std::vector<haddr_t> addresses(_n_blocks);
+    std::vector<size_t> offset;
+    std::vector<hsize_t> coords(_dims.size());
+    for (size_t index = 0; index < _n_blocks; ++index) {
+        getOffset(index, offset);
+        std::copy(offset.begin(), offset.end(), coords.begin());
+        unsigned filter_mask = 0;
+        hsize_t size = 0;
+        if (H5Dget_chunk_info_by_coord(_dataset.getId(), coords.data(), &filter_mask,
+                                       &addresses[index], &size) < 0) {
+            HDF5ErrMapper::ToException<DataSetException>("Unable to get the address of chunk");
+        }
+    }
+    _order.resize(_n_blocks);
+    std::iota(_order.begin(), _order.end(), size_t{0});
+    // Unallocated chunks have an undefined address, the largest one
+    std::stable_sort(_order.begin(), _order.end(), [&addresses](size_t a, size_t b) {
+        return addresses[a] < addresses[b];
+    });
+#endif
+}
+
+template <typename T>
+inline void ChunkRange<T>::load(size_t index, Block& block) const {
+    getOffset(_order.empty() ? index : _order[index], block.offset);
+    block.count.resize(_dims.size());
+    for (size_t i = 0; i < _dims.size(); ++i) {
+        block.count[i] = std::min(_block_dims[i], _dims[i] - block.offset[i]);
+    }
+    block.data.resize(std::accumulate(block.count.begin(), block.count.end(), size_t{1},
+                                      std::multiplies<size_t>()));
+    _dataset.select(block.offset, block.count).read(block.data.data());
+}
+
+template <typename T>
+inline void ChunkRange<T>::startPrefetch(size_t index) {
+    if (index >= _n_blocks) {
+        return;
+    }
+    if (_prefetch) {
+        _pending = std::async(std::launch::async, [this, index]() { load(index, _next); });
+    } else {
+        load(index, _next);
+    }
+}
+
+template <typename T>
+inline typename ChunkRange<T>::iterator ChunkRange<T>::begin() {
+    if (_pending.valid()) {
+        _pending.wait();
+    }
+    _index = 0;
+    if (_n_blocks > 0) {
+        load(0, _current);
+        startPrefetch(1);
+    }
+    return iterator(this, 0);
+}
+
+template <typename T>
+inline typename ChunkRange<T>::iterator ChunkRange<T>::end() {
+    return iterator(this, _n_blocks);
+}
+
+template <typename T>
+inline void ChunkRange<T>::advance() {
+    ++_index;
+    if (_index >= _n_blocks) {
+        return;
+    }
+    if (_pending.valid()) {
+        _pending.get();  // rethrows read errors
+    }
+    std::swap(_current, _next);
+    startPrefetch(_index + 1);
+}
+
+}  // namespace HighFive
+
+#endif  // H5CHUNKRANGE_MISC_HPP
@@ -28,6 +28,7 @@
 #include <H5Ppublic.h>
 
 #include "../H5Reference.hpp"
+#include "../H5Utility.hpp"
 #include "H5Utils.hpp"
 
 namespace HighFive {
@@ -59,23 +60,24 @@ inline void check_dimensions_vector(size_t size_vec, size_t size_dataset,
 // =================
 
 // copy multi dimensional vector in C++ in one C-style multi dimensional buffer
-template <typename T>
-inline void vectors_to_single_buffer(const std::vector<T>& vec_single_dim,
+template <typename T, typename A, typename B>
+inline void vectors_to_single_buffer(const std::vector<T, A>& vec_single_dim,
                                      const std::vector<size_t>& dims,
                                      const size_t current_dim,
-                                     std::vector<T>& buffer) {
+                                     std::vector<T, B>& buffer) {
 
     check_dimensions_vector(vec_single_dim.size(), dims[current_dim], current_dim);
     buffer.insert(buffer.end(), vec_single_dim.begin(), vec_single_dim.end());
 }
 
 
-template <typename T, typename U = typename type_of_array<T>::type>
+template <typename T, typename A, typename B,
+          typename U = typename type_of_array<T>::type>
 inline void
-vectors_to_single_buffer(const std::vector<T>& vec_multi_dim,
+vectors_to_single_buffer(const std::vector<T, A>& vec_multi_dim,
                          const std::vector<size_t>& dims,
                          size_t current_dim,
-                         std::vector<U>& buffer) {
+                         std::vector<U, B>& buffer) {
 
     check_dimensions_vector(vec_multi_dim.size(), dims[current_dim], current_dim);
     for (const auto& it : vec_multi_dim) {
@@ -84,26 +86,26 @@ vectors_to_single_buffer(const std::vector<T>& vec_multi_dim,
 }
 
 // copy single buffer to multi dimensional vector, following specified dimensions
-template <typename T>
-inline typename std::vector<T>::const_iterator
-single_buffer_to_vectors(typename std::vector<T>::const_iterator begin_buffer,
-                         typename std::vector<T>::const_iterator end_buffer,
+template <typename T, typename A, typename Iterator>
+inline Iterator
+single_buffer_to_vectors(Iterator begin_buffer,
+                         Iterator end_buffer,
                          const std::vector<size_t>& dims,
                          const size_t current_dim,
-                         std::vector<T>& vec_single_dim) {
+                         std::vector<T, A>& vec_single_dim) {
     const auto n_elems = static_cast<long>(dims[current_dim]);
     const auto end_copy_iter = std::min(begin_buffer + n_elems, end_buffer);
     vec_single_dim.assign(begin_buffer, end_copy_iter);
     return end_copy_iter;
 }
 
-template <typename T, typename U = typename type_of_array<T>::type>
-inline typename std::vector<U>::const_iterator
-single_buffer_to_vectors(typename std::vector<U>::const_iterator begin_buffer,
-                         typename std::vector<U>::const_iterator end_buffer,
+template <typename T, typename A, typename B, typename Iterator>
+inline Iterator
+single_buffer_to_vectors(Iterator begin_buffer,
+                         Iterator end_buffer,
                          const std::vector<size_t>& dims,
                          const size_t current_dim,
-                         std::vector<std::vector<T>>& vec_multi_dim) {
+                         std::vector<std::vector<T, A>, B>& vec_multi_dim) {
     const size_t n_elems = dims[current_dim];
     vec_multi_dim.resize(n_elems);
 
@@ -188,16 +190,16 @@ struct container_converter {
 
 
 // apply conversion for vectors 1D
-template <typename T>
+template <typename T, typename Allocator>
 struct data_converter<
-    std::vector<T>,
+    std::vector<T, Allocator>,
     typename std::enable_if<(
         std::is_same<T, typename type_of_array<T>::type>::value &&
         !std::is_same<T, Reference>::value
         )>::type>
-    : public container_converter<std::vector<T>> {
+    : public container_converter<std::vector<T, Allocator>> {
 
-    using container_converter<std::vector<T>>::container_converter;
+    using container_converter<std::vector<T, Allocator>>::container_converter;
 };
 
 
@@ -280,32 +282,33 @@ struct data_converter<boost::numeric::ublas::matrix<T>, void>
 
 
 // apply conversion for vectors nested vectors
-template <typename T>
-struct data_converter<std::vector<T>,
+template <typename T, typename Allocator>
+struct data_converter<std::vector<T, Allocator>,
                       typename std::enable_if<(is_container<T>::value)>::type> {
     using value_type = typename type_of_array<T>::type;
 
     inline data_converter(const DataSpace& space)
         : _dims(space.getDimensions()) {}
 
-    inline value_type* transform_read(std::vector<T>&) {
+    inline value_type* transform_read(std::vector<T, Allocator>&) {
         _vec_align.resize(compute_total_size(_dims));
         return _vec_align.data();
     }
 
-    inline const value_type* transform_write(const std::vector<T>& vec) {
+    inline const value_type* transform_write(const std::vector<T, Allocator>& vec) {
         _vec_align.reserve(compute_total_size(_dims));
-        vectors_to_single_buffer<T>(vec, _dims, 0, _vec_align);
+        vectors_to_single_buffer(vec, _dims, 0, _vec_align);
         return _vec_align.data();
     }
 
-    inline void process_result(std::vector<T>& vec) const {
+    inline void process_result(std::vector<T, Allocator>& vec) const {
         single_buffer_to_vectors(
             _vec_align.cbegin(), _vec_align.cend(), _dims, 0, vec);
     }
 
     std::vector<size_t> _dims;
-    std::vector<typename type_of_array<T>::type> _vec_align;
+    // Fully overwritten by HDF5 on read, no need to zero it first
+    std::vector<value_type, DefaultInitAllocator<value_type>> _vec_align;
 };
 
 
@@ -334,7 +337,7 @@ struct data_converter<std::string, void> {
         str = std::string(_c_vec);
 
         if (_c_vec != nullptr) {
-            AtomicType<std::string> str_type;
+            const DataType& str_type = cached_datatype<std::string>();
             (void)H5Dvlen_reclaim(str_type.getId(), _space.getId(), H5P_DEFAULT,
                                   &_c_vec);
         }
@@ -373,7 +376,7 @@ struct data_converter<std::vector<std::string>, void> {
         }
 
         if (_c_vec.empty() == false && _c_vec[0] != NULL) {
-            AtomicType<std::string> str_type;
+            const DataType& str_type = cached_datatype<std::string>();
             (void)H5Dvlen_reclaim(str_type.getId(), _space.getId(), H5P_DEFAULT,
                                   &(_c_vec[0]));
         }
@@ -0,0 +1,139 @@
+/*
+ *  Copyright (c), 2020, Blue Brain Project - EPFL
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#ifndef H5DATASETAPPENDER_MISC_HPP
+#define H5DATASETAPPENDER_MISC_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <sstream>
+
+#include "H5DataSet_misc.hpp"
+
+namespace HighFive {
+
+namespace details {
+
+// Bytes written at once by a DataSetAppender, when not given
+static constexpr std::size_t appender_block_bytes = 1024 * 1024;
+
+}  // namespace details
+
+
+template <typename T>
+inline DataSetAppender<T>::DataSetAppender(const DataSet& dataset, std::size_t block_rows)
+    : _dataset(dataset)
+    , _dims(dataset.getDimensions())
+    , _max_rows(0)
+    , _row_size(0)
+    , _block_rows(block_rows)
+    , _n_written(0)
+    , _n_pending(0) {
+    if (_dims.empty()) {
+        throw DataSetException("Impossible to append to a scalar DataSet");
+    }
+    const std::vector<std::size_t> chunk_dims = details::get_chunk_dims(dataset);
+    if (chunk_dims.empty()) {
+        throw DataSetException("Impossible to append to a DataSet without chunking");
+    }
+    _max_rows = dataset.getMaxDimensions()[0];
+    _row_size = std::accumulate(_dims.begin() + 1, _dims.end(), std::size_t{1},
+                                std::multiplies<std::size_t>());
+    if (_block_rows == 0) {
+        const std::size_t chunk_bytes = std::max(chunk_dims[0] * _row_size * sizeof(T),
+                                                 std::size_t{1});
+        _block_rows = chunk_dims[0] * std::max(details::appender_block_bytes / chunk_bytes,
+                                               std::size_t{1});
+    }
+    _n_written = _dims[0];
+    _buffer.resize(_block_rows * _row_size);
+}
+
+template <typename T>
+inline DataSetAppender<T>::~DataSetAppender() {
+    try {
+        flush();
+    } catch (const std::exception&) {
+        // Nothing to report to, see flush()
+    }
+}
+
+template <typename T>
+inline std::size_t DataSetAppender<T>::rowsToBoundary() const noexcept {
+    return _block_rows - _n_written % _block_rows;
+}
+
+template <typename T>
+inline void DataSetAppender<T>::append(const T& value) {
+    if (_row_size != 1) {
+        std::ostringstream ss;
+        ss << "Impossible to append a single value as a row of " << _row_size << " elements";
+        throw DataSpaceException(ss.str());
+    }
+    append(&value, 1);
+}
+
+template <typename T>
+inline void DataSetAppender<T>::append(const T* row) {
+    append(row, 1);
+}
+
+template <typename T>
+inline void DataSetAppender<T>::append(const T* rows, std::size_t n_rows) {
+    while (n_rows > 0) {
+        const std::size_t n_copied = std::min(n_rows, rowsToBoundary() - _n_pending);
+        std::copy(rows, rows + n_copied * _row_size,
+                  _buffer.begin() + static_cast<std::ptrdiff_t>(_n_pending * _row_size));
+        _n_pending += n_copied;
+        rows += n_copied * _row_size;
+        n_rows -= n_copied;
+        if (_n_pending == rowsToBoundary()) {
+            writePending();
+        }
+    }
+}
+
+template <typename T>
+inline void DataSetAppender<T>::writePending() {
+    if (_n_pending == 0) {
+        return;
+    }
+    const std::size_t n_rows = _n_written + _n_pending;
+    if (n_rows > _max_rows) {
+        throw DataSetException("Impossible to append beyond the maximum dimensions of the DataSet");
+    }
+    if (n_rows > _dims[0]) {
+        // Geometric growth, by whole blocks
+        std::size_t new_rows = std::max(n_rows, 2 * _dims[0]);
+        new_rows = (new_rows + _block_rows - 1) / _block_rows * _block_rows;
+        _dims[0] = std::min(new_rows, _max_rows);
+        _dataset.resize(_dims);
+    }
+
+    std::vector<std::size_t> offset(_dims.size(), 0), count(_dims);
+    offset[0] = _n_written;
+    count[0] = _n_pending;
+    _dataset.select(offset, count).write_raw(_buffer.data());
+    _n_written = n_rows;
+    _n_pending = 0;
+}
+
+template <typename T>
+inline void DataSetAppender<T>::flush() {
+    writePending();
+    if (_dims[0] != _n_written) {
+        _dims[0] = _n_written;
+        _dataset.resize(_dims);
+    }
+}
+
+}  // namespace HighFive
+
+#endif  // H5DATASETAPPENDER_MISC_HPP
@@ -11,6 +11,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <limits>
 #include <numeric>
 #include <sstream>
 #include <string>
@@ -22,10 +23,218 @@
 #include <H5Dpublic.h>
 #include <H5Ppublic.h>
 
+#include "../H5PropertyList.hpp"
+#include "../H5Selection.hpp"
+#include "H5ChunkCache_misc.hpp"
 #include "H5Utils.hpp"
 
 namespace HighFive {
 
+namespace details {
+
+// Dimensions of the chunks of a dataset, empty if it isn't chunked
+inline std::vector<size_t> get_chunk_dims(const DataSet& dataset) {
+    const hid_t plist = H5Dget_create_plist(dataset.getId());
+    if (plist < 0) {
+        HDF5ErrMapper::ToException<DataSetException>(
+            "Unable to get the creation properties of the DataSet");
+    }
+    std::vector<size_t> chunk_dims;
+    if (H5Pget_layout(plist) == H5D_CHUNKED) {
+        const int rank = H5Pget_chunk(plist, 0, nullptr);
+        std::vector<hsize_t> dims(static_cast<size_t>(std::max(rank, 0)));
+        if (rank > 0 && H5Pget_chunk(plist, rank, dims.data()) == rank) {
+            chunk_dims.assign(dims.begin(), dims.end());
+        }
+    }
+    H5Pclose(plist);
+    return chunk_dims;
+}
+
+inline void record_chunk_access(const DataSet& dataset, const DataSpace& file_space) {
+    if (dataset._metadata && dataset._metadata->cache_model) {
+        dataset._metadata->cache_model->access(file_space);
+    }
+}
+
+}  // namespace details
+
+inline Caching::Caching(const DataSet& dataset, CacheAccess access, size_t maxBytes)
+    : Caching(forAccess(dataset.getDimensions(), details::get_chunk_dims(dataset),
+                        dataset.getDataType().getSize(), access, maxBytes)) {}
+
+inline void DataSet::enableCacheStatistics() {
+    const std::vector<size_t> chunk_dims = details::get_chunk_dims(*this);
+    if (chunk_dims.empty()) {
+        throw DataSetException("Impossible to count the chunk cache accesses of a "
+                               "DataSet without chunking");
+    }
+    const hid_t plist = H5Dget_access_plist(_hid);
+    size_t n_slots = 0, cache_bytes = 0;
+    double w0 = 0.;
+    const herr_t status = H5Pget_chunk_cache(plist, &n_slots, &cache_bytes, &w0);
+    H5Pclose(plist);
+    if (plist < 0 || status < 0) {
+        HDF5ErrMapper::ToException<DataSetException>(
+            "Unable to get the chunk cache properties of the DataSet");
+    }
+    const size_t chunk_bytes = std::accumulate(chunk_dims.begin(), chunk_dims.end(),
+                                               getDataType().getSize(),
+                                               std::multiplies<size_t>());
+    getMetadata();
+    _metadata->cache_model = std::make_shared<details::ChunkCacheModel>(
+        chunk_dims, chunk_bytes, n_slots, cache_bytes);
+}
+
+inline ChunkCacheStatistics DataSet::getCacheStatistics() const {
+    ChunkCacheStatistics statistics;
+    if (_metadata && _metadata->cache_model) {
+        const auto counts = _metadata->cache_model->getCounts();
+        statistics.hits = counts.first;
+        statistics.misses = counts.second;
+    }
+    return statistics;
+}
+
+template <typename T>
+inline std::vector<size_t> DataSet::readRanges(
+    const std::vector<std::pair<size_t, size_t>>& ranges,
+    std::vector<T>& out,
+    const DataTransferProps& xfer_props) const {
+    const std::vector<size_t> dims = getDimensions();
+    if (dims.empty()) {
+        throw DataSetException("Impossible to read ranges of rows of a scalar DataSet");
+    }
+    const size_t row_size = std::accumulate(dims.begin() + 1, dims.end(), size_t{1},
+                                            std::multiplies<size_t>());
+
+    std::vector<size_t> offsets(ranges.size() + 1, 0);
+    bool in_order = true;
+    size_t previous_last = 0;
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        const size_t first = ranges[i].first, last = ranges[i].second;
+        if (first > last || last > dims[0]) {
+            std::ostringstream ss;
+            ss << "Impossible to read rows [" << first << ", " << last
+               << ") of a DataSet of " << dims[0] << " rows";
+            throw DataSpaceException(ss.str());
+        }
+        offsets[i + 1] = offsets[i] + (last - first);
+        if (first < last) {
+            in_order = in_order && first >= previous_last;
+            previous_last = last;
+        }
+    }
+
+    // Union of the ranges, in file order
+    std::vector<std::pair<size_t, size_t>> merged;
+    for (const auto& range : ranges) {
+        if (range.first < range.second) {
+            merged.push_back(range);
+        }
+    }
+    std::sort(merged.begin(), merged.end());
+    size_t n_merged = 0;
+    for (const auto& range : merged) {
+        if (n_merged > 0 && range.first <= merged[n_merged - 1].second) {
+            merged[n_merged - 1].second = std::max(merged[n_merged - 1].second, range.second);
+        } else {
+            merged[n_merged++] = range;
+        }
+    }
+    merged.resize(n_merged);
+
+    out.resize(offsets.back() * row_size);
+    if (merged.empty()) {
+        return offsets;
+    }
+
+    HyperSlab slab;
+    std::vector<size_t> start(dims.size(), 0), count(dims.size(), 1), block(dims);
+    size_t n_rows = 0;
+    for (const auto& range : merged) {
+        start[0] = range.first;
+        block[0] = range.second - range.first;
+        slab |= RegularHyperSlab(start, count, std::vector<size_t>(), block);
+        n_rows += block[0];
+    }
+    const Selection selection = select(slab, DataSpace(n_rows * row_size));
+    if (in_order) {
+        selection.read(out, xfer_props);
+        return offsets;
+    }
+
+    std::vector<T> rows;
+    selection.read(rows, xfer_props);
+    // First row of each merged range among the rows read
+    std::vector<size_t> merged_offsets(merged.size(), 0);
+    for (size_t i = 1; i < merged.size(); ++i) {
+        merged_offsets[i] = merged_offsets[i - 1] + (merged[i - 1].second - merged[i - 1].first);
+    }
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        if (ranges[i].first == ranges[i].second) {
+            continue;
+        }
+        const size_t j = static_cast<size_t>(
+            std::upper_bound(merged.begin(), merged.end(),
+                             std::make_pair(ranges[i].first, std::numeric_limits<size_t>::max())) -
+            merged.begin() - 1);
+        const size_t row = merged_offsets[j] + (ranges[i].first - merged[j].first);
+        std::copy(rows.begin() + static_cast<std::ptrdiff_t>(row * row_size),
+                  rows.begin() + static_cast<std::ptrdiff_t>(
+                                     (row + ranges[i].second - ranges[i].first) * row_size),
+                  out.begin() + static_cast<std::ptrdiff_t>(offsets[i] * row_size));
+    }
+    return offsets;
+}
+
+#ifdef H5_HAVE_PARALLEL
+template <typename T>
+inline size_t DataSet::writeDistributed(MPI_Comm comm, const std::vector<T>& local_rows) {
+    std::vector<size_t> dims = getDimensions();
+    if (dims.empty()) {
+        throw DataSetException("Impossible to append to a scalar DataSet");
+    }
+    const size_t row_size = std::accumulate(dims.begin() + 1, dims.end(), size_t{1},
+                                            std::multiplies<size_t>());
+    if (row_size == 0 ? !local_rows.empty() : local_rows.size() % row_size != 0) {
+        std::ostringstream ss;
+        ss << "Impossible to append " << local_rows.size()
+           << " elements as rows of " << row_size << " elements";
+        throw DataSpaceException(ss.str());
+    }
+
+    // Rows of the ranks before this one, and of all the ranks
+    unsigned long long n_local = row_size == 0 ? 0 : local_rows.size() / row_size;
+    unsigned long long n_before = 0, n_total = 0;
+    int rank = 0;
+    if (MPI_Comm_rank(comm, &rank) != MPI_SUCCESS ||
+        MPI_Exscan(&n_local, &n_before, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm) !=
+            MPI_SUCCESS ||
+        MPI_Allreduce(&n_local, &n_total, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm) !=
+            MPI_SUCCESS) {
+        throw DataSetException("Unable to exchange the numbers of rows to append");
+    }
+    if (rank == 0) {
+        n_before = 0;  // undefined after MPI_Exscan
+    }
+
+    const size_t first_row = dims[0] + static_cast<size_t>(n_before);
+    if (n_total > 0) {
+        dims[0] += static_cast<size_t>(n_total);
+        resize(dims);
+    }
+
+    std::vector<size_t> offset(dims.size(), 0), count(dims);
+    offset[0] = first_row;
+    count[0] = static_cast<size_t>(n_local);
+    DataTransferProps xfer_props;
+    xfer_props.add(UseCollectiveIO());
+    select(offset, count).write_raw(local_rows.data(), DataType(), xfer_props);
+    return first_row;
+}
+#endif  // H5_HAVE_PARALLEL
+
 inline std::string DataSet::getPath() const {
     return details::get_name([&](char *buffer, hsize_t length) {
         return H5Iget_name(_hid, buffer, length);
@@ -37,7 +246,12 @@ inline uint64_t DataSet::getStorageSize() const {
 }
 
 inline DataType DataSet::getDataType() const {
-    return DataType(H5Dget_type(_hid));
+    const hid_t type_id = H5Tcopy(getMetadata()->data_type.getId());
+    if (type_id < 0) {
+        HDF5ErrMapper::ToException<DataSetException>(
+            "Unable to get DataType out of DataSet");
+    }
+    return DataType(type_id);
 }
 
 inline DataSpace DataSet::getSpace() const {
@@ -53,6 +267,28 @@ inline DataSpace DataSet::getMemSpace() const {
     return getSpace();
 }
 
+inline std::shared_ptr<const DataSet::Metadata::Snapshot> DataSet::getMetadata() const {
+    if (!_metadata) {
+        _metadata = std::make_shared<Metadata>();
+    }
+    Metadata& metadata = *_metadata;
+    std::lock_guard<std::mutex> lock(metadata.mutex);
+    if (!metadata.snapshot) {
+        auto snapshot = std::make_shared<Metadata::Snapshot>();
+        snapshot->space = getSpace();
+        snapshot->dims = snapshot->space.getDimensions();
+        snapshot->max_dims = snapshot->space.getMaxDimensions();
+        const hid_t type_id = H5Dget_type(_hid);
+        if (type_id < 0) {
+            HDF5ErrMapper::ToException<DataSetException>(
+                "Unable to get DataType out of DataSet");
+        }
+        snapshot->data_type = DataType(type_id);
+        metadata.snapshot = std::move(snapshot);
+    }
+    return metadata.snapshot;
+}
+
 inline uint64_t DataSet::getOffset() const {
     uint64_t addr = H5Dget_offset(_hid);
     if (addr == HADDR_UNDEF) {
@@ -64,7 +300,7 @@ inline uint64_t DataSet::getOffset() const {
 
 inline void DataSet::resize(const std::vector<size_t>& dims) {
 
-    const size_t numDimensions = getSpace().getDimensions().size();
+    const size_t numDimensions = getMetadata()->dims.size();
     if (dims.size() != numDimensions) {
         HDF5ErrMapper::ToException<DataSetException>(
             "Invalid dataspace dimensions, got " + std::to_string(dims.size()) +
@@ -77,6 +313,8 @@ inline void DataSet::resize(const std::vector<size_t>& dims) {
         HDF5ErrMapper::ToException<DataSetException>(
             "Could not resize dataset.");
     }
+    std::lock_guard<std::mutex> lock(_metadata->mutex);
+    _metadata->snapshot.reset();
 }
 
 } // namespace HighFive
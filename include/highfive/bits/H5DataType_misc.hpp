@@ -9,6 +9,7 @@
 #ifndef H5DATATYPE_MISC_HPP
 #define H5DATATYPE_MISC_HPP
 
+#include <algorithm>
 #include <string>
 #include <complex>
 #include <cstring>
@@ -187,11 +188,32 @@ AtomicType<T>::AtomicType() {
 
 // class FixedLenStringArray<N>
 
+namespace details {
+
+// Copies a string into a fixed-length slot, truncating to keep the null
+// terminator and zero-filling the rest of the slot
+template <std::size_t N>
+inline void copy_padded(std::array<char, N>& dst, const char* src, std::size_t length) {
+    length = std::min(N - 1, length);
+    std::memcpy(dst.data(), src, length);
+    std::memset(dst.data() + length, 0, N - length);
+}
+
+// Length of a fixed-length string, which might not be null terminated
+inline std::size_t fixed_length(const char* src, std::size_t n) noexcept {
+    const void* end = std::memchr(src, 0, n);
+    return end ? static_cast<std::size_t>(static_cast<const char*>(end) - src) : n;
+}
+
+}  // namespace details
+
 template <std::size_t N>
 inline FixedLenStringArray<N>
 ::FixedLenStringArray(const char array[][N], std::size_t length) {
     datavec.resize(length);
-    std::memcpy(datavec[0].data(), array[0].data(), N * length);
+    if (length > 0) {
+        std::memcpy(data(), array[0], N * length);
+    }
 }
 
 template <std::size_t N>
@@ -199,40 +221,116 @@ inline FixedLenStringArray<N>
 ::FixedLenStringArray(const std::string* iter_begin, const std::string* iter_end) {
     datavec.resize(static_cast<std::size_t>(iter_end - iter_begin));
     for (auto& dst_array : datavec) {
-        const char* src = (iter_begin++)->c_str();
-        const size_t length = std::min(N - 1 , std::strlen(src));
-        std::memcpy(dst_array.data(), src, length);
-        dst_array[length] = 0;
+        details::copy_padded(dst_array, iter_begin->data(), iter_begin->size());
+        ++iter_begin;
     }
 }
 
 template <std::size_t N>
 inline FixedLenStringArray<N>
 ::FixedLenStringArray(const std::vector<std::string> & vec)
-    : FixedLenStringArray(&vec.front(), &vec.back()) {}
+    : FixedLenStringArray(vec.data(), vec.data() + vec.size()) {}
 
 template <std::size_t N>
 inline FixedLenStringArray<N>
 ::FixedLenStringArray(const std::initializer_list<std::string>& init_list)
     : FixedLenStringArray(init_list.begin(), init_list.end()) {}
 
+template <std::size_t N>
+inline FixedLenStringArray<N>
+::FixedLenStringArray(const StringColumn& column) {
+    datavec.resize(column.size());
+    for (std::size_t i = 0; i < datavec.size(); ++i) {
+        details::copy_padded(datavec[i], column[i], column.length(i));
+    }
+}
+
 template <std::size_t N>
 inline void FixedLenStringArray<N>::push_back(const std::string& src) {
     datavec.emplace_back();
-    const size_t length = std::min(N - 1 , src.length());
-    std::memcpy(datavec.back().data(), src.c_str(), length);
-    datavec.back()[length] = 0;
+    details::copy_padded(datavec.back(), src.data(), src.size());
 }
 
 template <std::size_t N>
 inline void FixedLenStringArray<N>::push_back(const std::array<char, N>& src) {
-    datavec.emplace_back();
-    std::copy(src.begin(), src.end(), datavec.back().data());
+    datavec.push_back(src);
+}
+
+template <std::size_t N>
+inline std::size_t FixedLenStringArray<N>::length(std::size_t i) const noexcept {
+    return details::fixed_length(datavec[i].data(), N);
 }
 
 template <std::size_t N>
 inline std::string FixedLenStringArray<N>::getString(std::size_t i) const {
-    return std::string(datavec[i].data());
+    return std::string(datavec[i].data(), length(i));
+}
+
+template <std::size_t N>
+inline void FixedLenStringArray<N>::getStrings(std::vector<std::string>& strings) const {
+    strings.resize(datavec.size());
+    for (std::size_t i = 0; i < datavec.size(); ++i) {
+        strings[i].assign(datavec[i].data(), length(i));
+    }
+}
+
+template <std::size_t N>
+inline std::vector<std::string> FixedLenStringArray<N>::getStrings() const {
+    std::vector<std::string> strings;
+    getStrings(strings);
+    return strings;
+}
+
+#if __cplusplus >= 201703L
+template <std::size_t N>
+inline std::vector<std::string_view> FixedLenStringArray<N>::getStringViews() const {
+    std::vector<std::string_view> views;
+    views.reserve(datavec.size());
+    for (std::size_t i = 0; i < datavec.size(); ++i) {
+        views.emplace_back(datavec[i].data(), length(i));
+    }
+    return views;
+}
+#endif
+
+// class StringColumn
+
+inline StringColumn::StringColumn(const std::vector<std::string>& vec) {
+    std::size_t n_chars = 0;
+    for (const auto& str : vec) {
+        n_chars += str.size() + 1;
+    }
+    reserve(vec.size(), n_chars);
+    for (const auto& str : vec) {
+        push_back(str);
+    }
+}
+
+inline StringColumn::StringColumn(const std::initializer_list<std::string>& init_list)
+    : StringColumn(std::vector<std::string>(init_list)) {}
+
+inline void StringColumn::reserve(std::size_t n_strings, std::size_t n_chars) {
+    _offsets.reserve(n_strings + 1);
+    _chars.reserve(n_chars);
+}
+
+inline void StringColumn::push_back(const char* str, std::size_t length) {
+    _chars.insert(_chars.end(), str, str + length);
+    _chars.push_back('\0');
+    _offsets.push_back(_chars.size());
+}
+
+inline void StringColumn::push_back(const std::string& str) {
+    push_back(str.data(), str.size());
+}
+
+inline void StringColumn::clear() noexcept {
+    _chars.clear();
+    _offsets.resize(1);
+}
+
+inline std::string StringColumn::getString(std::size_t i) const {
+    return std::string(operator[](i), length(i));
 }
 
 // Internal
@@ -423,6 +521,27 @@ inline DataType create_and_check_datatype() {
     return t;
 }
 
+namespace details {
+
+// Process-wide instances of the memory datatypes, created on first use
+// (thread-safe static initialization). They are deliberately never destroyed,
+// HDF5 releasing its ids itself when shutting down. The ids are shared: they
+// are only meant for the read/write paths and must not be modified.
+template <typename T>
+inline const DataType& cached_datatype() {
+    static const DataType* const datatype = new DataType(create_datatype<T>());
+    return *datatype;
+}
+
+template <typename T>
+inline const DataType& cached_checked_datatype() {
+    static const bool checked = (create_and_check_datatype<T>(), true);
+    (void) checked;
+    return cached_datatype<T>();
+}
+
+}  // namespace details
+
 }  // namespace HighFive
 
 
@@ -148,9 +148,9 @@ inline DataSpace DataSpace::From(const ScalarValue& scalar) {
     return DataSpace(DataSpace::datascape_scalar);
 }
 
-template <typename Value>
-inline DataSpace DataSpace::From(const std::vector<Value>& container) {
-    return DataSpace(details::get_dim_vector<Value>(container));
+template <typename Value, typename Allocator>
+inline DataSpace DataSpace::From(const std::vector<Value, Allocator>& container) {
+    return DataSpace(details::get_dim_vector(container));
 }
 
 template <typename ValueT, std::size_t N>
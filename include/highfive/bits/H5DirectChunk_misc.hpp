@@ -0,0 +1,616 @@
+/*
+ *  Copyright (c), 2020, Blue Brain Project - EPFL
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#ifndef H5DIRECTCHUNK_MISC_HPP
+#define H5DIRECTCHUNK_MISC_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <thread>
+
+#include <H5Dpublic.h>
+#include <H5Ppublic.h>
+#include <H5Zpublic.h>
+#include <zlib.h>
+
+#include "../H5Utility.hpp"
+#include "H5DataSet_misc.hpp"
+
+namespace HighFive {
+
+namespace details {
+
+// Chunks queued per thread between the thread doing the I/O and the threads
+// filtering them, bounding the memory used
+static constexpr std::size_t chunks_per_thread = 4;
+
+inline std::size_t default_thread_count() {
+    return std::max(std::size_t{std::thread::hardware_concurrency()}, std::size_t{1});
+}
+
+// A chunk in transit, identified by its index in the block
+struct QueuedChunk {
+    std::size_t index;
+    std::vector<char> data;
+    std::uint32_t filter_mask;
+};
+
+// Chunks exchanged between threads, at most `capacity` at once
+class ChunkQueue {
+  public:
+    inline explicit ChunkQueue(std::size_t capacity)
+        : _capacity(std::max(capacity, std::size_t{1}))
+        , _closed(false) {}
+
+    // Blocks while the queue is full. Returns false if it was closed.
+    inline bool push(QueuedChunk&& chunk) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _not_full.wait(lock, [this] { return _closed || _chunks.size() < _capacity; });
+        if (_closed) {
+            return false;
+        }
+        _chunks.push_back(std::move(chunk));
+        _not_empty.notify_one();
+        return true;
+    }
+
+    // Blocks while the queue is empty. Returns false once it is closed and
+    // empty.
+    inline bool pop(QueuedChunk& chunk) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _not_empty.wait(lock, [this] { return _closed || !_chunks.empty(); });
+        if (_chunks.empty()) {
+            return false;
+        }
+        chunk = std::move(_chunks.front());
+        _chunks.pop_front();
+        _not_full.notify_one();
+        return true;
+    }
+
+    // Wakes up the waiting threads. Chunks left can still be popped.
+    inline void close() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _closed = true;
+        _not_full.notify_all();
+        _not_empty.notify_all();
+    }
+
+  private:
+    std::size_t _capacity;
+    bool _closed;
+    std::deque<QueuedChunk> _chunks;
+    std::mutex _mutex;
+    std::condition_variable _not_full;
+    std::condition_variable _not_empty;
+};
+
+// Threads running `work()` for the lifetime of a transfer. The first
+// exception thrown by one of them is kept, and `on_error()` called to wake
+// up the others.
+class ChunkThreads {
+  public:
+    template <typename Work, typename OnError>
+    inline ChunkThreads(std::size_t n_threads, const Work& work, const OnError& on_error) {
+        auto run = [this, work, on_error]() {
+            try {
+                work();
+            } catch (...) {
+                {
+                    std::lock_guard<std::mutex> lock(_error_mutex);
+                    if (!_error) {
+                        _error = std::current_exception();
+                    }
+                }
+                on_error();
+            }
+        };
+        try {
+            for (std::size_t i = 0; i < n_threads; ++i) {
+                _threads.emplace_back(run);
+            }
+        } catch (...) {
+            on_error();
+            wait();
+            throw;
+        }
+    }
+
+    ChunkThreads(const ChunkThreads&) = delete;
+    ChunkThreads& operator=(const ChunkThreads&) = delete;
+
+    inline ~ChunkThreads() {
+        wait();
+    }
+
+    // Waits for the threads, rethrowing the first exception of one of them
+    inline void join() {
+        wait();
+        if (_error) {
+            std::rethrow_exception(_error);
+        }
+    }
+
+  private:
+    inline void wait() noexcept {
+        for (auto& thread : _threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+    }
+
+    std::vector<std::thread> _threads;
+    std::mutex _error_mutex;
+    std::exception_ptr _error;
+};
+
+// Fill value of a dataset, as stored by HDF5 in chunks never written
+template <typename T>
+inline T get_fill_value(const DataSet& dataset, const DataType& mem_datatype) {
+    T fill_value{};
+    const hid_t plist = H5Dget_create_plist(dataset.getId());
+    if (plist < 0) {
+        HDF5ErrMapper::ToException<DataSetException>(
+            "Unable to get the creation properties of the DataSet");
+    }
+    const herr_t status = H5Pget_fill_value(plist, mem_datatype.getId(), &fill_value);
+    H5Pclose(plist);
+    if (status < 0) {
+        HDF5ErrMapper::ToException<DataSetException>(
+            "Unable to get the fill value of the DataSet");
+    }
+    return fill_value;
+}
+
+// Calls f(block_pos, chunk_pos, n) for each row of a region of extent
+// `extent`, at `block_origin` in a row-major block and at `chunk_origin` in
+// a full, row-major, chunk. Positions are in elements.
+template <typename F>
+inline void for_each_chunk_row(const std::vector<std::size_t>& block_dims,
+                               const std::vector<std::size_t>& block_origin,
+                               const std::vector<std::size_t>& chunk_dims,
+                               const std::vector<std::size_t>& chunk_origin,
+                               const std::vector<std::size_t>& extent,
+                               const F& f) {
+    const std::size_t rank = block_dims.size();
+    std::vector<std::size_t> index(rank, 0);
+    while (true) {
+        std::size_t block_pos = 0, chunk_pos = 0;
+        for (std::size_t i = 0; i < rank; ++i) {
+            block_pos = block_pos * block_dims[i] + block_origin[i] + index[i];
+            chunk_pos = chunk_pos * chunk_dims[i] + chunk_origin[i] + index[i];
+        }
+        f(block_pos, chunk_pos, extent[rank - 1]);
+
+        // Next row, last dimension excluded
+        std::size_t i = rank - 1;
+        while (i-- > 0) {
+            if (++index[i] < extent[i]) {
+                break;
+            }
+            index[i] = 0;
+        }
+        if (i == std::size_t(-1)) {
+            return;
+        }
+    }
+}
+
+// Position, in a block of whole chunks, of the chunk at the given index
+// of its grid, and its extent clipped to the block
+inline void get_chunk_position(std::size_t index,
+                               const std::vector<std::size_t>& block_dims,
+                               const std::vector<std::size_t>& chunk_dims,
+                               std::vector<std::size_t>& origin,
+                               std::vector<std::size_t>& extent) {
+    const std::size_t rank = block_dims.size();
+    origin.resize(rank);
+    extent.resize(rank);
+    for (std::size_t i = rank; i-- > 0;) {
+        const std::size_t n_chunks = (block_dims[i] + chunk_dims[i] - 1) / chunk_dims[i];
+        origin[i] = (index % n_chunks) * chunk_dims[i];
+        extent[i] = std::min(chunk_dims[i], block_dims[i] - origin[i]);
+        index /= n_chunks;
+    }
+}
+
+inline void shuffle_bytes(const char* in, char* out, std::size_t n_bytes,
+                          std::size_t element_size) {
+    const std::size_t n = n_bytes / element_size;
+    for (std::size_t j = 0; j < element_size; ++j) {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[j * n + i] = in[i * element_size + j];
+        }
+    }
+    std::memcpy(out + n * element_size, in + n * element_size, n_bytes - n * element_size);
+}
+
+inline void unshuffle_bytes(const char* in, char* out, std::size_t n_bytes,
+                            std::size_t element_size) {
+    const std::size_t n = n_bytes / element_size;
+    for (std::size_t j = 0; j < element_size; ++j) {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i * element_size + j] = in[j * n + i];
+        }
+    }
+    std::memcpy(out + n * element_size, in + n * element_size, n_bytes - n * element_size);
+}
+
+// Size of a chunk in the file, 0 if it was never written
+inline hsize_t get_stored_chunk_size(const DataSet& dataset, const hsize_t* offset) {
+    hsize_t size = 0;
+#if H5_VERSION_GE(1, 10, 5)
+    unsigned filter_mask = 0;
+    haddr_t address = HADDR_UNDEF;
+    if (H5Dget_chunk_info_by_coord(dataset.getId(), offset, &filter_mask, &address,
+                                   &size) < 0) {
+        HDF5ErrMapper::ToException<DataSetException>("Unable to get the storage size of chunk");
+    }
+    return address == HADDR_UNDEF ? 0 : size;
+#else
+    // Fails for chunks which aren't allocated
+    SilenceHDF5 silence;
+    return H5Dget_chunk_storage_size(dataset.getId(), offset, &size) < 0 ? 0 : size;
+#endif
+}
+
+inline ChunkFilters::ChunkFilters(const DataSet& dataset) {
+    const hid_t plist = H5Dget_create_plist(dataset.getId());
+    if (plist < 0) {
+        HDF5ErrMapper::ToException<DataSetException>(
+            "Unable to get the creation properties of the DataSet");
+    }
+    const int n_filters = H5Pget_nfilters(plist);
+    // HDF5 then stores the partial edge chunks unfiltered, which the direct
+    // chunk calls leave to the caller
+    unsigned chunk_opts = 0;
+    if (n_filters > 0 && H5Pget_chunk_opts(plist, &chunk_opts) >= 0 &&
+        (chunk_opts & H5D_CHUNK_DONT_FILTER_PARTIAL_CHUNKS) != 0) {
+        H5Pclose(plist);
+        throw DataSetException(
+            "Direct chunk access doesn't support DataSets not filtering partial chunks");
+    }
+    for (int i = 0; i < n_filters; ++i) {
+        unsigned flags = 0;
+        size_t n_values = 8;
+        unsigned values[8] = {0};
+        char name[64];
+        unsigned config = 0;
+        const H5Z_filter_t id = H5Pget_filter2(plist, static_cast<unsigned>(i), &flags,
+                                               &n_values, values, sizeof(name), name,
+                                               &config);
+        if (id != H5Z_FILTER_SHUFFLE && id != H5Z_FILTER_DEFLATE) {
+            H5Pclose(plist);
+            std::ostringstream ss;
+            ss << "Unsupported filter " << id << " for direct chunk access";
+            throw DataSetException(ss.str());
+        }
+        _filters.push_back({id, n_values > 0 ? values[0] : 0});
+    }
+    H5Pclose(plist);
+}
+
+inline void ChunkFilters::encode(std::vector<char>& chunk, std::vector<char>& scratch) const {
+    for (const auto& filter : _filters) {
+        if (filter.id == H5Z_FILTER_SHUFFLE) {
+            if (filter.parameter <= 1) {
+                continue;
+            }
+            scratch.resize(chunk.size());
+            shuffle_bytes(chunk.data(), scratch.data(), chunk.size(), filter.parameter);
+        } else {
+            uLongf size = compressBound(static_cast<uLong>(chunk.size()));
+            scratch.resize(size);
+            if (compress2(reinterpret_cast<Bytef*>(scratch.data()), &size,
+                          reinterpret_cast<const Bytef*>(chunk.data()),
+                          static_cast<uLong>(chunk.size()),
+                          static_cast<int>(filter.parameter)) != Z_OK) {
+                throw DataSetException("Unable to compress chunk");
+            }
+            scratch.resize(size);
+        }
+        chunk.swap(scratch);
+    }
+}
+
+inline void ChunkFilters::decode(std::vector<char>& chunk, std::vector<char>& scratch,
+                                 std::uint32_t filter_mask, std::size_t chunk_bytes) const {
+    for (std::size_t i = _filters.size(); i-- > 0;) {
+        const Filter& filter = _filters[i];
+        if (filter_mask & (1u << i)) {
+            continue;  // skipped when the chunk was written
+        }
+        if (filter.id == H5Z_FILTER_SHUFFLE) {
+            if (filter.parameter <= 1) {
+                continue;
+            }
+            scratch.resize(chunk.size());
+            unshuffle_bytes(chunk.data(), scratch.data(), chunk.size(), filter.parameter);
+        } else {
+            uLongf size = static_cast<uLongf>(chunk_bytes);
+            scratch.resize(chunk_bytes);
+            if (uncompress(reinterpret_cast<Bytef*>(scratch.data()), &size,
+                           reinterpret_cast<const Bytef*>(chunk.data()),
+                           static_cast<uLong>(chunk.size())) != Z_OK ||
+                size != chunk_bytes) {
+                throw DataSetException("Unable to decompress chunk");
+            }
+        }
+        chunk.swap(scratch);
+    }
+    if (chunk.size() != chunk_bytes) {
+        throw DataSetException("Unexpected size of decoded chunk");
+    }
+}
+
+}  // namespace details
+
+
+template <typename T>
+inline ChunkWriter<T>::ChunkWriter(const DataSet& dataset, std::size_t n_threads)
+    : _dataset(dataset)
+    , _dims(dataset.getDimensions())
+    , _chunk_dims(details::get_chunk_dims(dataset))
+    , _filters(dataset)
+    , _n_threads(n_threads > 0 ? n_threads : details::default_thread_count())
+    , _fill_value() {
+    if (_chunk_dims.empty()) {
+        throw DataSetException("Impossible to write chunks of a DataSet without chunking");
+    }
+    const DataType& mem_datatype = details::cached_checked_datatype<T>();
+    const DataType file_datatype = dataset.getDataType();
+    if (file_datatype != mem_datatype) {
+        throw DataTypeException("Impossible to write chunks of a DataSet of type " +
+                                file_datatype.string() + " from " +
+                                mem_datatype.string());
+    }
+    _fill_value = details::get_fill_value<T>(dataset, mem_datatype);
+}
+
+template <typename T>
+inline void ChunkWriter<T>::write(const T* data) {
+    write(std::vector<std::size_t>(_dims.size(), 0), _dims, data);
+}
+
+template <typename T>
+inline void ChunkWriter<T>::write(const std::vector<std::size_t>& offset,
+                                  const std::vector<std::size_t>& count,
+                                  const T* data) {
+    const std::size_t rank = _dims.size();
+    if (offset.size() != rank || count.size() != rank) {
+        throw DataSpaceException("Block dimensions don't match the DataSet");
+    }
+    std::size_t n_chunks = 1;
+    for (std::size_t i = 0; i < rank; ++i) {
+        if (count[i] > _dims[i] || offset[i] > _dims[i] - count[i]) {
+            throw DataSpaceException("Block selection out of the DataSet bounds");
+        }
+        if (offset[i] % _chunk_dims[i] != 0 ||
+            (count[i] % _chunk_dims[i] != 0 && offset[i] + count[i] != _dims[i])) {
+            throw DataSpaceException("Block selection not aligned on the chunks");
+        }
+        n_chunks *= (count[i] + _chunk_dims[i] - 1) / _chunk_dims[i];
+    }
+    const std::size_t chunk_size = std::accumulate(_chunk_dims.begin(), _chunk_dims.end(),
+                                                   std::size_t{1},
+                                                   std::multiplies<std::size_t>());
+
+    if (n_chunks == 0) {
+        return;
+    }
+
+    // The threads filter the chunks, the calling thread writes them as they
+    // are done
+    details::ChunkQueue filtered(_n_threads * details::chunks_per_thread);
+    std::atomic<std::size_t> next(0);
+    details::ChunkThreads threads(
+        std::min(_n_threads, n_chunks),
+        [&]() {
+            const std::vector<std::size_t> zeros(rank, 0);
+            std::vector<std::size_t> origin, extent;
+            std::vector<char> scratch;
+            std::size_t k;
+            while ((k = next++) < n_chunks) {
+                details::get_chunk_position(k, count, _chunk_dims, origin, extent);
+                details::QueuedChunk chunk{k, std::vector<char>(chunk_size * sizeof(T)), 0};
+                if (extent != _chunk_dims) {
+                    // Edges outside of the dataset, as H5Dwrite stores them
+                    T* elements = reinterpret_cast<T*>(chunk.data.data());
+                    std::fill(elements, elements + chunk_size, _fill_value);
+                }
+                details::for_each_chunk_row(
+                    count, origin, _chunk_dims, zeros, extent,
+                    [&](std::size_t block_pos, std::size_t chunk_pos, std::size_t n_elements) {
+                        std::memcpy(chunk.data.data() + chunk_pos * sizeof(T),
+                                    data + block_pos, n_elements * sizeof(T));
+                    });
+                _filters.encode(chunk.data, scratch);
+                if (!filtered.push(std::move(chunk))) {
+                    return;
+                }
+            }
+        },
+        [&]() { filtered.close(); });
+
+    try {
+        std::vector<std::size_t> origin, extent;
+        std::vector<hsize_t> chunk_offset(rank);
+        details::QueuedChunk chunk;
+        for (std::size_t n_written = 0; n_written < n_chunks && filtered.pop(chunk);
+             ++n_written) {
+            details::get_chunk_position(chunk.index, count, _chunk_dims, origin, extent);
+            for (std::size_t i = 0; i < rank; ++i) {
+                chunk_offset[i] = offset[i] + origin[i];
+            }
+            if (H5Dwrite_chunk(_dataset.getId(), H5P_DEFAULT, 0, chunk_offset.data(),
+                               chunk.data.size(), chunk.data.data()) < 0) {
+                HDF5ErrMapper::ToException<DataSetException>("Unable to write chunk");
+            }
+        }
+    } catch (...) {
+        filtered.close();
+        throw;
+    }
+    threads.join();
+}
+
+
+template <typename T>
+inline ChunkReader<T>::ChunkReader(const DataSet& dataset, std::size_t n_threads)
+    : _dataset(dataset)
+    , _dims(dataset.getDimensions())
+    , _chunk_dims(details::get_chunk_dims(dataset))
+    , _filters(dataset)
+    , _n_threads(n_threads > 0 ? n_threads : details::default_thread_count())
+    , _fill_value() {
+    if (_chunk_dims.empty()) {
+        throw DataSetException("Impossible to read chunks of a DataSet without chunking");
+    }
+    const DataType& mem_datatype = details::cached_checked_datatype<T>();
+    const DataType file_datatype = dataset.getDataType();
+    if (file_datatype != mem_datatype) {
+        throw DataTypeException("Impossible to read chunks of a DataSet of type " +
+                                file_datatype.string() + " as " +
+                                mem_datatype.string());
+    }
+    _fill_value = details::get_fill_value<T>(dataset, mem_datatype);
+}
+
+template <typename T>
+inline void ChunkReader<T>::read(T* data) const {
+    read(std::vector<std::size_t>(_dims.size(), 0), _dims, data);
+}
+
+template <typename T>
+inline void ChunkReader<T>::read(const std::vector<std::size_t>& offset,
+                                 const std::vector<std::size_t>& count,
+                                 T* data) const {
+    const std::size_t rank = _dims.size();
+    if (offset.size() != rank || count.size() != rank) {
+        throw DataSpaceException("Block dimensions don't match the DataSet");
+    }
+    // Chunks covered by the block, as a block of the chunk grid
+    std::vector<std::size_t> first_chunk(rank), grid_dims(rank), ones(rank, 1);
+    std::size_t n_chunks = 1;
+    for (std::size_t i = 0; i < rank; ++i) {
+        if (count[i] > _dims[i] || offset[i] > _dims[i] - count[i]) {
+            throw DataSpaceException("Block selection out of the DataSet bounds");
+        }
+        if (count[i] == 0) {
+            return;
+        }
+        first_chunk[i] = offset[i] / _chunk_dims[i];
+        grid_dims[i] = (offset[i] + count[i] - 1) / _chunk_dims[i] - first_chunk[i] + 1;
+        n_chunks *= grid_dims[i];
+    }
+    const std::size_t chunk_bytes = sizeof(T) *
+                                    std::accumulate(_chunk_dims.begin(), _chunk_dims.end(),
+                                                    std::size_t{1},
+                                                    std::multiplies<std::size_t>());
+
+    // Chunks still in the chunk cache aren't seen by the direct chunk calls
+    if (H5Dflush(_dataset.getId()) < 0) {
+        HDF5ErrMapper::ToException<DataSetException>("Unable to flush the DataSet");
+    }
+    const bool allocated = _dataset.getStorageSize() > 0;
+
+    // Offset in the dataset of the chunk at the given index of the grid
+    auto get_chunk_offset = [&](std::size_t k, std::vector<std::size_t>& grid_position,
+                                std::vector<hsize_t>& chunk_offset) {
+        std::vector<std::size_t> unused;
+        details::get_chunk_position(k, grid_dims, ones, grid_position, unused);
+        chunk_offset.resize(rank);
+        for (std::size_t i = 0; i < rank; ++i) {
+            chunk_offset[i] = (first_chunk[i] + grid_position[i]) * _chunk_dims[i];
+        }
+    };
+
+    // The calling thread reads the chunks, the threads decode them as they
+    // arrive
+    details::ChunkQueue stored(_n_threads * details::chunks_per_thread);
+    details::ChunkThreads threads(
+        std::min(_n_threads, n_chunks),
+        [&]() {
+            std::vector<std::size_t> grid_position, block_origin(rank), chunk_origin(rank),
+                extent(rank);
+            std::vector<hsize_t> chunk_offset;
+            std::vector<char> scratch;
+            details::QueuedChunk chunk;
+            while (stored.pop(chunk)) {
+                // Part of the chunk inside the block
+                get_chunk_offset(chunk.index, grid_position, chunk_offset);
+                for (std::size_t i = 0; i < rank; ++i) {
+                    const std::size_t chunk_start = static_cast<std::size_t>(chunk_offset[i]);
+                    const std::size_t start = std::max(offset[i], chunk_start);
+                    const std::size_t end = std::min(offset[i] + count[i],
+                                                     chunk_start + _chunk_dims[i]);
+                    block_origin[i] = start - offset[i];
+                    chunk_origin[i] = start - chunk_start;
+                    extent[i] = end - start;
+                }
+
+                if (chunk.data.empty()) {
+                    details::for_each_chunk_row(
+                        count, block_origin, _chunk_dims, chunk_origin, extent,
+                        [&](std::size_t block_pos, std::size_t, std::size_t n_elements) {
+                            std::fill(data + block_pos, data + block_pos + n_elements,
+                                      _fill_value);
+                        });
+                    continue;
+                }
+                _filters.decode(chunk.data, scratch, chunk.filter_mask, chunk_bytes);
+                details::for_each_chunk_row(
+                    count, block_origin, _chunk_dims, chunk_origin, extent,
+                    [&](std::size_t block_pos, std::size_t chunk_pos, std::size_t n_elements) {
+                        std::memcpy(data + block_pos,
+                                    chunk.data.data() + chunk_pos * sizeof(T),
+                                    n_elements * sizeof(T));
+                    });
+            }
+        },
+        [&]() { stored.close(); });
+
+    try {
+        std::vector<std::size_t> grid_position;
+        std::vector<hsize_t> chunk_offset;
+        for (std::size_t k = 0; k < n_chunks; ++k) {
+            get_chunk_offset(k, grid_position, chunk_offset);
+            const hsize_t stored_bytes =
+                allocated ? details::get_stored_chunk_size(_dataset, chunk_offset.data()) : 0;
+            details::QueuedChunk chunk{
+                k, std::vector<char>(static_cast<std::size_t>(stored_bytes)), 0};
+            if (stored_bytes > 0 &&
+                H5Dread_chunk(_dataset.getId(), H5P_DEFAULT, chunk_offset.data(),
+                              &chunk.filter_mask, chunk.data.data()) < 0) {
+                HDF5ErrMapper::ToException<DataSetException>("Unable to read chunk");
+            }
+            if (!stored.push(std::move(chunk))) {
+                break;
+            }
+        }
+    } catch (...) {
+        stored.close();
+        throw;
+    }
+    stored.close();
+    threads.join();
+}
+
+}  // namespace HighFive
+
+#endif  // H5DIRECTCHUNK_MISC_HPP
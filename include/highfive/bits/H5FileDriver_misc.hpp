@@ -10,6 +10,9 @@
 #ifndef H5FILEDRIVER_MISC_HPP
 #define H5FILEDRIVER_MISC_HPP
 
+#include <string>
+
+#include <H5FDcore.h>
 #include <H5Ppublic.h>
 
 #ifdef H5_HAVE_PARALLEL
@@ -40,6 +43,25 @@ private:
   Info _info;
 };
 
+class CoreFileAccess
+{
+public:
+  CoreFileAccess(size_t increment, bool backingStore)
+      : _increment(increment)
+      , _backingStore(backingStore)
+  {}
+
+  void apply(const hid_t list) const {
+    if (H5Pset_fapl_core(list, _increment, _backingStore) < 0) {
+        HDF5ErrMapper::ToException<FileException>(
+            "Unable to set-up Core Driver configuration");
+    }
+  }
+private:
+  size_t _increment;
+  bool _backingStore;
+};
+
 }  //namespace
 
 template <typename Comm, typename Info>
@@ -47,6 +69,92 @@ inline MPIOFileDriver::MPIOFileDriver(Comm comm, Info info) {
     add(MPIOFileAccess<Comm, Info>(comm, info));
 }
 
+#ifdef H5_HAVE_PARALLEL
+
+namespace details {
+
+inline const char* toggle_hint(MPIOHints::Toggle toggle) {
+    switch (toggle) {
+    case MPIOHints::Toggle::Enable:
+        return "enable";
+    case MPIOHints::Toggle::Disable:
+        return "disable";
+    default:
+        return "automatic";
+    }
+}
+
+}  // namespace details
+
+inline MPIOHints& MPIOHints::setCollectiveBufferingNodes(int n_nodes) {
+    return set("cb_nodes", std::to_string(n_nodes));
+}
+
+inline MPIOHints& MPIOHints::setCollectiveBufferSize(size_t size) {
+    return set("cb_buffer_size", std::to_string(size));
+}
+
+inline MPIOHints& MPIOHints::setCollectiveBufferingWrite(Toggle toggle) {
+    return set("romio_cb_write", details::toggle_hint(toggle));
+}
+
+inline MPIOHints& MPIOHints::setCollectiveBufferingRead(Toggle toggle) {
+    return set("romio_cb_read", details::toggle_hint(toggle));
+}
+
+inline MPIOHints& MPIOHints::setStripingFactor(int n_targets) {
+    return set("striping_factor", std::to_string(n_targets));
+}
+
+inline MPIOHints& MPIOHints::setStripingUnit(size_t size) {
+    return set("striping_unit", std::to_string(size));
+}
+
+inline MPIOHints& MPIOHints::set(const std::string& key, const std::string& value) {
+    _hints[key] = value;
+    return *this;
+}
+
+inline MPIOFileDriver::MPIOFileDriver(MPI_Comm comm, const MPIOHints& hints) {
+    MPI_Info info;
+    if (MPI_Info_create(&info) != MPI_SUCCESS) {
+        throw FileException("Unable to create the MPI-IO hints");
+    }
+    try {
+        for (const auto& hint : hints.getHints()) {
+            if (MPI_Info_set(info, hint.first.c_str(), hint.second.c_str()) != MPI_SUCCESS) {
+                throw FileException("Unable to set the MPI-IO hint " + hint.first);
+            }
+        }
+        // HDF5 keeps its own copy of the hints
+        add(MPIOFileAccess<MPI_Comm, MPI_Info>(comm, info));
+    } catch (...) {
+        MPI_Info_free(&info);
+        throw;
+    }
+    MPI_Info_free(&info);
+}
+
+inline void MPIOCollectiveMetadataRead::apply(const hid_t hid) const {
+    if (H5Pset_all_coll_metadata_ops(hid, _enable) < 0) {
+        HDF5ErrMapper::ToException<FileException>(
+            "Unable to set collective metadata reads");
+    }
+}
+
+inline void MPIOCollectiveMetadataWrite::apply(const hid_t hid) const {
+    if (H5Pset_coll_metadata_write(hid, _enable) < 0) {
+        HDF5ErrMapper::ToException<FileException>(
+            "Unable to set collective metadata writes");
+    }
+}
+
+#endif  // H5_HAVE_PARALLEL
+
+inline CoreFileDriver::CoreFileDriver(size_t increment, bool backingStore) {
+    add(CoreFileAccess(increment, backingStore));
+}
+
 } // namespace HighFive
 
 #endif // H5FILEDRIVER_MISC_HPP
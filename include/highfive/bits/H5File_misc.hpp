@@ -9,9 +9,12 @@
 #ifndef H5FILE_MISC_HPP
 #define H5FILE_MISC_HPP
 
+#include <atomic>
+#include <sstream>
 #include <string>
 
 #include <H5Fpublic.h>
+#include <H5Ppublic.h>
 
 #include "../H5Utility.hpp"
 
@@ -35,6 +38,24 @@ inline unsigned convert_open_flag(unsigned openFlags) {
         res_open |= H5F_ACC_EXCL;
     return res_open;
 }
+
+// Opens the image given to the core driver instead of a file
+class FileImageAccess {
+  public:
+    FileImageAccess(const void* image, size_t size)
+        : _image(image)
+        , _size(size) {}
+
+    void apply(const hid_t list) const {
+        if (H5Pset_file_image(list, const_cast<void*>(_image), _size) < 0) {
+            HDF5ErrMapper::ToException<FileException>("Unable to set the file image");
+        }
+    }
+
+  private:
+    const void* _image;
+    size_t _size;
+};
 }  // namespace
 
 
@@ -80,6 +101,41 @@ inline const std::string& File::getName() const noexcept {
     return _filename;
 }
 
+inline File File::fromImage(const void* image, size_t size, unsigned openFlags) {
+    // Files of the core driver are told apart by their names
+    static std::atomic<unsigned long> n_images(0);
+    std::ostringstream name;
+    name << "HighFive file image " << n_images++;
+
+    CoreFileDriver driver;
+    driver.add(FileImageAccess(image, size));
+    return File(name.str(), openFlags & ReadWrite, driver);
+}
+
+inline File File::fromImage(const std::vector<char>& image, unsigned openFlags) {
+    return fromImage(image.data(), image.size(), openFlags);
+}
+
+inline std::vector<char> File::toImage() const {
+    unsigned intent = 0;
+    if (H5Fget_intent(_hid, &intent) >= 0 && (intent & H5F_ACC_RDWR) &&
+        H5Fflush(_hid, H5F_SCOPE_LOCAL) < 0) {
+        HDF5ErrMapper::ToException<FileException>(
+            std::string("Unable to flush file " + _filename));
+    }
+    const ssize_t size = H5Fget_file_image(_hid, NULL, 0);
+    if (size < 0) {
+        HDF5ErrMapper::ToException<FileException>(
+            std::string("Unable to get the image size of file " + _filename));
+    }
+    std::vector<char> image(static_cast<size_t>(size));
+    if (H5Fget_file_image(_hid, image.data(), image.size()) < 0) {
+        HDF5ErrMapper::ToException<FileException>(
+            std::string("Unable to get the image of file " + _filename));
+    }
+    return image;
+}
+
 inline void File::flush() {
     if (H5Fflush(_hid, H5F_SCOPE_GLOBAL) < 0) {
         HDF5ErrMapper::ToException<FileException>(
@@ -79,6 +79,15 @@ class NodeTraits {
                   const DataSetCreateProps& createProps = DataSetCreateProps(),
                   const DataSetAccessProps& accessProps = DataSetAccessProps());
 
+    ///
+    /// \brief createDataSet create a new dataset of variable-length strings
+    /// and write the content of a StringColumn to it.
+    DataSet
+    createDataSet(const std::string& dataset_name,
+                  const StringColumn& data,
+                  const DataSetCreateProps& createProps = DataSetCreateProps(),
+                  const DataSetAccessProps& accessProps = DataSetAccessProps());
+
     ///
     /// \brief get an existing dataset in the current file
     /// \param dataset_name
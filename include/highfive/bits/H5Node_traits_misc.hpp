@@ -23,6 +23,7 @@
 #include "../H5Group.hpp"
 #include "../H5Selection.hpp"
 #include "../H5Utility.hpp"
+#include "H5ChunkRange_misc.hpp"
 #include "H5DataSet_misc.hpp"
 #include "H5Iterables_misc.hpp"
 #include "H5Selection_misc.hpp"
@@ -90,6 +91,18 @@ NodeTraits<Derivate>::createDataSet(const std::string& dataset_name,
     return ds;
 }
 
+template <typename Derivate>
+inline DataSet
+NodeTraits<Derivate>::createDataSet(const std::string& dataset_name,
+                                    const StringColumn& data,
+                                    const DataSetCreateProps& createProps,
+                                    const DataSetAccessProps& accessProps) {
+    DataSet ds = createDataSet<std::string>(
+        dataset_name, DataSpace(data.size()), createProps, accessProps);
+    ds.write(data);
+    return ds;
+}
+
 template <typename Derivate>
 inline DataSet
 NodeTraits<Derivate>::getDataSet(const std::string& dataset_name,
@@ -9,8 +9,14 @@
 #ifndef H5PROPERTY_LIST_MISC_HPP
 #define H5PROPERTY_LIST_MISC_HPP
 
+#include <algorithm>
+
 #include <H5Ppublic.h>
 
+#ifdef H5_HAVE_PARALLEL
+#include <H5FDmpi.h>
+#endif
+
 namespace HighFive {
 
 namespace {
@@ -101,6 +107,18 @@ inline void PropertyList<T>::add(const P& property) {
     property.apply(_hid);
 }
 
+template <PropertyType T>
+inline RawPropertyList<T>::RawPropertyList(const PropertyList<T>& other) {
+    if (other.getId() == H5P_DEFAULT) {
+        return;
+    }
+    if ((this->_hid = H5Pcopy(other.getId())) < 0) {
+        this->_hid = H5P_DEFAULT;
+        HDF5ErrMapper::ToException<PropertyException>(
+            "Unable to copy property list");
+    }
+}
+
 template <PropertyType T>
 template <typename F, typename... Args>
 inline void RawPropertyList<T>::add(const F& funct, const Args&... args) {
@@ -111,6 +129,58 @@ inline void RawPropertyList<T>::add(const F& funct, const Args&... args) {
     }
 }
 
+inline std::vector<hsize_t> AutoChunking::getDimensions(
+    const std::vector<size_t>& dims,
+    const std::vector<size_t>& max_dims,
+    std::size_t element_size) const {
+    const std::size_t rank = dims.size();
+    if (rank == 0) {
+        throw DataSpaceException("Impossible to chunk a scalar DataSet");
+    }
+    if (!max_dims.empty() && max_dims.size() != rank) {
+        throw DataSpaceException("Maximum dimensions don't match the dimensions");
+    }
+    if (_access_axis != NoAxis && _access_axis >= rank) {
+        throw DataSpaceException("Access axis out of the dimensions of the DataSet");
+    }
+    const double max_elements = static_cast<double>(
+        std::max(_chunk_bytes / std::max(element_size, std::size_t{1}), std::size_t{1}));
+
+    // Start from the whole dataset, unlimited dimensions counting as the
+    // whole chunk, then halve the largest dimension until the chunk fits.
+    // The access axis is only halved once all the others are down to 1.
+    std::vector<hsize_t> chunk(rank);
+    double n_elements = 1.;
+    for (std::size_t i = 0; i < rank; ++i) {
+        const bool unlimited = !max_dims.empty() && max_dims[i] == DataSpace::UNLIMITED;
+        chunk[i] = unlimited ? static_cast<hsize_t>(max_elements)
+                             : std::max(static_cast<hsize_t>(dims[i]), hsize_t{1});
+        n_elements *= static_cast<double>(chunk[i]);
+    }
+    while (n_elements > max_elements) {
+        std::size_t axis = NoAxis;
+        for (std::size_t i = 0; i < rank; ++i) {
+            if (i != _access_axis && chunk[i] > 1 &&
+                (axis == NoAxis || chunk[i] > chunk[axis])) {
+                axis = i;
+            }
+        }
+        if (axis == NoAxis) {
+            axis = _access_axis;
+        }
+        n_elements /= static_cast<double>(chunk[axis]);
+        chunk[axis] = (chunk[axis] + 1) / 2;
+        n_elements *= static_cast<double>(chunk[axis]);
+    }
+    return chunk;
+}
+
+inline Chunking::Chunking(const DataSpace& space,
+                          const DataType& type,
+                          const AutoChunking& policy)
+    : _dims(policy.getDimensions(space.getDimensions(), space.getMaxDimensions(),
+                                 type.getSize())) {}
+
 inline void Chunking::apply(const hid_t hid) const {
     if (H5Pset_chunk(hid, static_cast<int>(_dims.size()), _dims.data()) < 0) {
         HDF5ErrMapper::ToException<PropertyException>(
@@ -142,6 +212,127 @@ inline void Shuffle::apply(const hid_t hid) const {
     }
 }
 
+inline void ConversionBuffer::apply(const hid_t hid) const {
+    if (H5Pset_buffer(hid, _size, NULL, NULL) < 0) {
+        HDF5ErrMapper::ToException<PropertyException>(
+            "Error setting conversion buffer property");
+    }
+}
+
+inline void HyperVectorSize::apply(const hid_t hid) const {
+    if (H5Pset_hyper_vector_size(hid, _size) < 0) {
+        HDF5ErrMapper::ToException<PropertyException>(
+            "Error setting hyper vector size property");
+    }
+}
+
+inline void DataTransform::apply(const hid_t hid) const {
+    if (H5Pset_data_transform(hid, _expression.c_str()) < 0) {
+        HDF5ErrMapper::ToException<PropertyException>(
+            "Error setting data transform property");
+    }
+}
+
+#ifdef H5_HAVE_PARALLEL
+
+inline void UseCollectiveIO::apply(const hid_t hid) const {
+    if (H5Pset_dxpl_mpio(hid, _enable ? H5FD_MPIO_COLLECTIVE : H5FD_MPIO_INDEPENDENT) < 0) {
+        HDF5ErrMapper::ToException<PropertyException>(
+            "Error setting MPI-IO transfer mode property");
+    }
+}
+
+inline MpioIOMode getMpioActualIOMode(const DataTransferProps& xfer_props) {
+    H5D_mpio_actual_io_mode_t mode;
+    if (H5Pget_mpio_actual_io_mode(xfer_props.getId(), &mode) < 0) {
+        HDF5ErrMapper::ToException<PropertyException>(
+            "Unable to get the actual MPI-IO mode");
+    }
+    switch (mode) {
+    case H5D_MPIO_CHUNK_INDEPENDENT:
+        return MpioIOMode::ChunkIndependent;
+    case H5D_MPIO_CHUNK_COLLECTIVE:
+        return MpioIOMode::ChunkCollective;
+    case H5D_MPIO_CHUNK_MIXED:
+        return MpioIOMode::ChunkMixed;
+    case H5D_MPIO_CONTIGUOUS_COLLECTIVE:
+        return MpioIOMode::ContiguousCollective;
+    default:
+        return MpioIOMode::NoCollective;
+    }
+}
+
+inline std::pair<uint32_t, uint32_t> getMpioNoCollectiveCause(
+    const DataTransferProps& xfer_props) {
+    uint32_t local_cause = 0, global_cause = 0;
+    if (H5Pget_mpio_no_collective_cause(xfer_props.getId(), &local_cause, &global_cause) < 0) {
+        HDF5ErrMapper::ToException<PropertyException>(
+            "Unable to get the causes of independent MPI-IO");
+    }
+    return {local_cause, global_cause};
+}
+
+#endif  // H5_HAVE_PARALLEL
+
+namespace details {
+
+// Smallest prime greater or equal to n, n >= 2
+inline size_t next_prime(size_t n) {
+    for (;; ++n) {
+        bool prime = true;
+        for (size_t d = 2; d * d <= n && prime; ++d) {
+            prime = n % d != 0;
+        }
+        if (prime) {
+            return n;
+        }
+    }
+}
+
+}  // namespace details
+
+inline Caching::Caching(const std::vector<size_t>& dims,
+                        const std::vector<size_t>& chunkDims,
+                        size_t elementSize,
+                        CacheAccess access,
+                        size_t maxBytes)
+    : Caching(forAccess(dims, chunkDims, elementSize, access, maxBytes)) {}
+
+inline Caching Caching::forAccess(const std::vector<size_t>& dims,
+                                  const std::vector<size_t>& chunkDims,
+                                  size_t elementSize,
+                                  CacheAccess access,
+                                  size_t maxBytes) {
+    const size_t rank = dims.size();
+    if (rank == 0 || chunkDims.size() != rank) {
+        throw PropertyException("Chunk dimensions don't match the dimensions of the DataSet");
+    }
+    size_t chunk_bytes = elementSize, n_total = 1;
+    std::vector<size_t> n_chunks(rank);
+    for (size_t i = 0; i < rank; ++i) {
+        chunk_bytes *= chunkDims[i];
+        n_chunks[i] = (std::max(dims[i], size_t{1}) + chunkDims[i] - 1) / chunkDims[i];
+        n_total *= n_chunks[i];
+    }
+
+    // Chunks to keep so that each one is read once
+    size_t n_cached = n_total;
+    if (access == CacheAccess::RowSweep) {
+        n_cached = n_total / n_chunks[0];
+    } else if (access == CacheAccess::ColumnSweep) {
+        n_cached = n_total / n_chunks[rank - 1];
+    }
+    n_cached = std::max(std::min(n_cached, maxBytes / std::max(chunk_bytes, size_t{1})),
+                        size_t{1});
+
+    // Sweeps are done with a chunk once it has been fully read
+    const double w0 = access == CacheAccess::Random
+                          ? static_cast<double>(H5D_CHUNK_CACHE_W0_DEFAULT)
+                          : 1.;
+    return Caching(details::next_prime(std::max(100 * n_cached, size_t{521})),
+                   n_cached * chunk_bytes, w0);
+}
+
 inline void Caching::apply(const hid_t hid) const {
     if (H5Pset_chunk_cache(hid, _numSlots, _cacheSize, _w0) < 0) {
         HDF5ErrMapper::ToException<PropertyException>(
@@ -21,56 +21,65 @@ struct BufferInfo {
     using char_array_t = typename details::type_char_array<type_no_const>::type;
     static constexpr bool is_char_array = ! std::is_same<char_array_t, void>::value;
 
-    BufferInfo(const DataType& dtype);
+    // warn_conversion: whether to warn when dtype and the buffer have types of
+    // different classes, not for the reads converted by HighFive
+    BufferInfo(const DataType& dtype, bool warn_conversion = true);
 
     // member data for info depending on the destination dataset type
     const bool is_fixed_len_string;
     const size_t n_dimensions;
-    const DataType data_type;
+    const DataType& data_type;
 };
 
 // details implementation
 template <typename SrcStrT>
 struct string_type_checker {
-    static DataType getDataType(const DataType&, bool);
+    static const DataType& getDataType(const DataType&, bool);
 };
 
 template <>
 struct string_type_checker<void> {
-inline static DataType getDataType(const DataType& element_type, bool) {
+inline static const DataType& getDataType(const DataType& element_type, bool) {
     return element_type;
 }};
 
 template <std::size_t FixedLen>
 struct string_type_checker<char[FixedLen]> {
-inline static DataType getDataType(const DataType& element_type, bool ds_fixed_str) {
-    return ds_fixed_str ? AtomicType<char[FixedLen]>() : element_type;
+inline static const DataType& getDataType(const DataType& element_type, bool ds_fixed_str) {
+    return ds_fixed_str ? cached_datatype<char[FixedLen]>() : element_type;
 }};
 
 template <>
 struct string_type_checker<char*> {
-inline static DataType getDataType(const DataType&, bool ds_fixed_str) {
+inline static const DataType& getDataType(const DataType&, bool ds_fixed_str) {
     if (ds_fixed_str)
         throw DataSetException("Can't output variable-length to fixed-length strings");
-    return AtomicType<std::string>();
+    return cached_datatype<std::string>();
 }};
 
+// Warns that data is converted by HDF5 between types of different classes.
+// In case they are really not convertible an exception will rise on read/write
+inline void warn_type_mismatch(const DataType& mem_datatype, const DataType& file_datatype) {
+    if (file_datatype.getClass() != mem_datatype.getClass()) {
+        std::cerr << "HighFive WARNING: data and hdf5 dataset have different types: "
+                  << mem_datatype.string() << " -> " << file_datatype.string() << std::endl;
+    }
+}
+
 template <typename T>
-BufferInfo<T>::BufferInfo(const DataType& dtype)
+BufferInfo<T>::BufferInfo(const DataType& dtype, bool warn_conversion)
     : is_fixed_len_string(dtype.isFixedLenStr())
     // In case we are using Fixed-len strings we need to subtract one dimension
     , n_dimensions(details::array_dims<type_no_const>::value -
                    ((is_fixed_len_string && is_char_array) ? 1 : 0))
     , data_type(string_type_checker<char_array_t>::getDataType(
-            create_datatype<elem_type>(), is_fixed_len_string)) {
+            cached_datatype<elem_type>(), is_fixed_len_string)) {
     if (is_fixed_len_string && std::is_same<elem_type, std::string>::value) {
         throw DataSetException("Can't output std::string as fixed-length. "
                                "Use raw arrays or FixedLenStringArray");
     }
-    // We warn. In case they are really not convertible an exception will rise on read/write
-    if (dtype.getClass() != data_type.getClass()) {
-        std::cerr << "HighFive WARNING: data and hdf5 dataset have different types: "
-                  << data_type.string() << " -> " << dtype.string() << std::endl;
+    if (warn_conversion) {
+        warn_type_mismatch(data_type, dtype);
     }
 }
 
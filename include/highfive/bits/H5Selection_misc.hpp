@@ -9,8 +9,19 @@
 #ifndef H5SELECTION_MISC_HPP
 #define H5SELECTION_MISC_HPP
 
+#include <H5Ipublic.h>
+#include <H5Spublic.h>
+
 namespace HighFive {
 
+namespace details {
+
+inline const std::vector<size_t>& get_column_order(const Selection& sel) {
+    return sel._column_order;
+}
+
+}  // namespace details
+
 inline Selection::Selection(const DataSpace& memspace,
                             const DataSpace& file_space, const DataSet& set)
     : _mem_space(memspace)
@@ -38,6 +49,97 @@ inline const DataType Selection::getDataType() const {
     return _set.getDataType();
 }
 
+inline Selection& Selection::shift(const std::vector<std::ptrdiff_t>& offset) {
+    const size_t rank = _file_space.getNumberDimensions();
+    if (offset.size() != rank) {
+        throw DataSpaceException("The offset of a selection must have its number of dimensions");
+    }
+    std::vector<std::ptrdiff_t> total = getOffset();
+    for (size_t i = 0; i < rank; ++i) {
+        total[i] += offset[i];
+    }
+    // Copies share the dataspace until moved
+    if (H5Iget_ref(_file_space.getId()) > 1) {
+        _file_space = _file_space.clone();
+    }
+    const hid_t space_id = _file_space.getId();
+
+    // Regular hyperslabs and points are selected again at their new position;
+    // other selections are moved by the offset of the dataspace, applied by
+    // HDF5 at each transfer
+    std::vector<hsize_t> start(rank), stride(rank), count(rank), block(rank);
+    const H5S_sel_type sel_type = H5Sget_select_type(space_id);
+    bool regular = false;
+#if H5_VERSION_GE(1, 10, 0)
+    regular = sel_type == H5S_SEL_HYPERSLABS && H5Sis_regular_hyperslab(space_id) > 0 &&
+              H5Sget_regular_hyperslab(space_id, start.data(), stride.data(), count.data(),
+                                       block.data()) >= 0;
+#endif
+    std::vector<hsize_t> points;
+    auto move = [&](const std::vector<hsize_t>& from, std::vector<hsize_t>& to) {
+        to.resize(from.size());
+        for (size_t i = 0; i < from.size(); ++i) {
+            const std::ptrdiff_t moved = static_cast<std::ptrdiff_t>(from[i]) + offset[i % rank];
+            if (moved < 0) {
+                throw DataSpaceException("Impossible to move a selection out of its DataSet");
+            }
+            to[i] = static_cast<hsize_t>(moved);
+        }
+    };
+
+    herr_t status;
+    if (regular) {
+        std::vector<hsize_t> moved;
+        move(start, moved);
+        status = H5Sselect_hyperslab(space_id, H5S_SELECT_SET, moved.data(), stride.data(),
+                                     count.data(), block.data());
+    } else if (sel_type == H5S_SEL_POINTS) {
+        const hssize_t n_points = H5Sget_select_npoints(space_id);
+        points.resize(static_cast<size_t>(std::max(n_points, hssize_t{0})) * rank);
+        if (H5Sget_select_elem_pointlist(space_id, 0, static_cast<hsize_t>(n_points),
+                                         points.data()) < 0) {
+            HDF5ErrMapper::ToException<DataSpaceException>("Unable to get the selected points");
+        }
+        std::vector<hsize_t> moved;
+        move(points, moved);
+        status = H5Sselect_elements(space_id, H5S_SELECT_SET, static_cast<size_t>(n_points),
+                                    moved.data());
+    } else {
+        const std::vector<hssize_t> space_offset(total.begin(), total.end());
+        status = H5Soffset_simple(space_id, space_offset.data());
+    }
+    if (status < 0) {
+        HDF5ErrMapper::ToException<DataSpaceException>("Unable to move the selection");
+    }
+    _offset = total;
+
+    if (H5Sselect_valid(space_id) <= 0) {
+        std::vector<std::ptrdiff_t> back(offset);
+        for (auto& value : back) {
+            value = -value;
+        }
+        shift(back);
+        throw DataSpaceException("Impossible to move a selection out of its DataSet");
+    }
+    return *this;
+}
+
+inline Selection& Selection::setOffset(const std::vector<std::ptrdiff_t>& offset) {
+    std::vector<std::ptrdiff_t> relative = offset;
+    const std::vector<std::ptrdiff_t> current = getOffset();
+    if (relative.size() == current.size()) {
+        for (size_t i = 0; i < relative.size(); ++i) {
+            relative[i] -= current[i];
+        }
+    }
+    return shift(relative);
+}
+
+inline std::vector<std::ptrdiff_t> Selection::getOffset() const {
+    return _offset.empty() ? std::vector<std::ptrdiff_t>(_file_space.getNumberDimensions(), 0)
+                           : _offset;
+}
+
 }  // namespace HighFive
 
 #endif // H5SELECTION_MISC_HPP
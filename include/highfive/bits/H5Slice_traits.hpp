@@ -10,8 +10,11 @@
 #define H5SLICE_TRAITS_HPP
 
 #include <cstdlib>
+#include <utility>
 #include <vector>
 
+#include "../H5ArrayView.hpp"
+#include "../H5PropertyList.hpp"
 #include "H5_definitions.hpp"
 #include "H5Utils.hpp"
 
@@ -50,6 +53,85 @@ class ElementSet {
 };
 
 
+///
+/// \brief A regular hyperslab: \p count blocks of \p block elements, separated
+/// by \p stride, starting at \p offset.
+///
+/// Strides and blocks default to 1 in all dimensions when not provided.
+struct RegularHyperSlab {
+    RegularHyperSlab() = default;
+
+    RegularHyperSlab(const std::vector<size_t>& offset_,
+                     const std::vector<size_t>& count_,
+                     const std::vector<size_t>& stride_ = std::vector<size_t>(),
+                     const std::vector<size_t>& block_ = std::vector<size_t>());
+
+    size_t rank() const noexcept {
+        return offset.size();
+    }
+
+    ///
+    /// \brief Dimensions of the selected elements, packed together
+    std::vector<size_t> packedDims() const;
+
+    std::vector<size_t> offset;
+    std::vector<size_t> count;
+    std::vector<size_t> stride;
+    std::vector<size_t> block;
+};
+
+///
+/// \brief A combination of regular hyperslabs, by set operations
+///
+/// Operations are only recorded, and applied in order to the dataspace of a
+/// DataSet when selecting it, so that complex patterns are read or written in
+/// a single call to HDF5.
+///
+/// \code{.cpp}
+/// // Checkerboard of 2x2 tiles
+/// HyperSlab board(RegularHyperSlab({0, 0}, {4, 4}, {4, 4}, {2, 2}));
+/// board |= RegularHyperSlab({2, 2}, {4, 4}, {4, 4}, {2, 2});
+/// std::vector<double> values;
+/// dataset.select(board).read(values);
+/// \endcode
+class HyperSlab {
+  public:
+    ///
+    /// \brief An empty selection
+    HyperSlab() = default;
+
+    explicit HyperSlab(const RegularHyperSlab& slab);
+
+    /// \brief Union with a hyperslab
+    HyperSlab& operator|=(const RegularHyperSlab& slab);
+    /// \brief Intersection with a hyperslab
+    HyperSlab& operator&=(const RegularHyperSlab& slab);
+    /// \brief Elements in either the selection or the hyperslab, but not both
+    HyperSlab& operator^=(const RegularHyperSlab& slab);
+    /// \brief Removes the elements of a hyperslab from the selection
+    HyperSlab& notB(const RegularHyperSlab& slab);
+    /// \brief Elements of a hyperslab which aren't in the selection
+    HyperSlab& notA(const RegularHyperSlab& slab);
+
+    HyperSlab operator|(const RegularHyperSlab& slab) const;
+    HyperSlab operator&(const RegularHyperSlab& slab) const;
+    HyperSlab operator^(const RegularHyperSlab& slab) const;
+
+    ///
+    /// \brief Apply the operations to a copy of a dataspace
+    DataSpace apply(const DataSpace& space) const;
+
+  private:
+    enum class Op { Set, Or, And, Xor, NotB, NotA };
+
+    HyperSlab& add(const RegularHyperSlab& slab, Op op);
+
+    std::vector<std::pair<RegularHyperSlab, Op>> _operations;
+
+    template <typename Derivate>
+    friend class SliceTraits;
+};
+
 template <typename Derivate>
 class SliceTraits {
   public:
@@ -68,13 +150,35 @@ class SliceTraits {
     ///
     /// \brief Select a set of columns in the last dimension of this dataset.
     ///
-    /// The column indices must be smaller than the dimension size.
+    /// The column indices must be smaller than the dimension size. Columns
+    /// are transferred in the given order, and may be repeated when reading.
+    /// They are selected in the file as runs of contiguous columns, or as a
+    /// single strided hyperslab for regular patterns.
     ///
     Selection select(const std::vector<size_t>& columns) const;
 
+    ///
+    /// \brief Select a combination of hyperslabs
+    ///
+    /// A single hyperslab keeps its dimensions, packed, in memory. Other
+    /// combinations are transferred as a one-dimensional array of their
+    /// elements, in the order of the dataset.
+    ///
+    Selection select(const HyperSlab& hyperslab) const;
+
+    ///
+    /// \brief Select a combination of hyperslabs, transferred to or from
+    /// \p memspace
+    ///
+    Selection select(const HyperSlab& hyperslab, const DataSpace& memspace) const;
+
     ///
     /// \brief Select a region in the current Slice/Dataset out of a list of elements.
     ///
+    /// Large selections are read by chunk: the bounding box of the points of a
+    /// chunk is read at once when they are dense enough, and the points
+    /// gathered from it in memory.
+    ///
     Selection select(const ElementSet& elements) const;
 
     ///
@@ -87,7 +191,7 @@ class SliceTraits {
     /// responsibility to ensure that the right amount of space has been
     /// allocated.
     template <typename T>
-    void read(T& array) const;
+    void read(T& array, const DataTransferProps& xfer_props = DataTransferProps()) const;
 
     ///
     /// Read the entire dataset into a raw buffer
@@ -97,8 +201,30 @@ class SliceTraits {
     /// allocated.
     /// \param array: A buffer containing enough space for the data
     /// \param dtype: The type of the data, in case it cannot be automatically guessed
+/// \param xfer_props: Transfer properties, e.g. a larger ConversionBuffer
     template <typename T>
-    void read(T* array, const DataType& dtype = DataType()) const;
+    void read(T* array,
+              const DataType& dtype = DataType(),
+              const DataTransferProps& xfer_props = DataTransferProps()) const;
+
+    ///
+    /// Read the selection into the elements of a (strided) view of user memory
+    ///
+    /// The view must hold as many elements as the selection. Data is scattered
+    /// by HDF5 directly into the viewed elements.
+    /// \param view: The destination elements
+    /// \param dtype: The type of the data, in case it cannot be automatically guessed
+/// \param xfer_props: Transfer properties, e.g. a larger ConversionBuffer
+    template <typename T, std::size_t N>
+    void read(ArrayView<T, N> view,
+              const DataType& dtype = DataType(),
+              const DataTransferProps& xfer_props = DataTransferProps()) const;
+
+    ///
+    /// Read variable-length strings into a StringColumn, storing all the
+    /// characters in a single buffer. The previous content is replaced, and
+    /// its storage reused when large enough.
+    void read(StringColumn& column, const DataTransferProps& xfer_props = DataTransferProps()) const;
 
     ///
     /// Write the integrality N-dimension buffer to this dataset
@@ -108,7 +234,7 @@ class SliceTraits {
     /// The array type can be a N-pointer or a N-vector ( e.g int** integer two
     /// dimensional array )
     template <typename T>
-    void write(const T& buffer);
+    void write(const T& buffer, const DataTransferProps& xfer_props = DataTransferProps());
 
     ///
     /// Write from a raw buffer into this dataset
@@ -119,8 +245,28 @@ class SliceTraits {
     /// default conventions.
     /// \param buffer: A buffer containing the data to be written
     /// \param dtype: The type of the data, in case it cannot be automatically guessed
+/// \param xfer_props: Transfer properties, e.g. a larger ConversionBuffer
     template <typename T>
-    void write_raw(const T* buffer, const DataType& dtype = DataType());
+    void write_raw(const T* buffer,
+                   const DataType& dtype = DataType(),
+                   const DataTransferProps& xfer_props = DataTransferProps());
+
+    ///
+    /// Write the elements of a (strided) view of user memory into this selection
+    ///
+    /// The view must hold as many elements as the selection. Data is gathered
+    /// by HDF5 directly from the viewed elements.
+    /// \param view: The source elements
+    /// \param dtype: The type of the data, in case it cannot be automatically guessed
+/// \param xfer_props: Transfer properties, e.g. a larger ConversionBuffer
+    template <typename T, std::size_t N>
+    void write(ArrayView<T, N> view,
+               const DataType& dtype = DataType(),
+               const DataTransferProps& xfer_props = DataTransferProps());
+
+    ///
+    /// Write the strings of a StringColumn as variable-length strings
+    void write(const StringColumn& column, const DataTransferProps& xfer_props = DataTransferProps());
 
 };
 
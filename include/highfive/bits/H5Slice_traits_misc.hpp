@@ -11,10 +11,13 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <numeric>
 #include <sstream>
 #include <string>
+#include <tuple>
 
 #ifdef H5_USE_BOOST
 // starting Boost 1.64, serialization header must come before ublas
@@ -54,6 +57,818 @@ inline hid_t get_memspace_id(const Selection& ptr) {
 inline hid_t get_memspace_id(const DataSet&) {
     return H5S_ALL;
 }
+
+// map the dataspaces of the layout, without querying the dataset
+// dataset -> cached space, identical in file and memory
+// selection -> its own spaces
+inline DataSpace get_file_space(const DataSet& ds) {
+    return ds.getMetadata()->space;
+}
+
+inline DataType get_file_datatype(const DataSet& ds) {
+    return ds.getMetadata()->data_type;
+}
+
+inline DataSpace get_file_space(const Selection& sel) {
+    return sel.getSpace();
+}
+
+inline DataType get_file_datatype(const Selection& sel) {
+    return get_file_datatype(sel.getDataset());
+}
+
+inline DataSpace get_mem_space(const DataSet& ds) {
+    return get_file_space(ds);
+}
+
+inline DataSpace get_mem_space(const Selection& sel) {
+    return sel.getMemSpace();
+}
+
+template <typename Slice>
+inline void record_chunk_access(const Slice& slice) {
+    record_chunk_access(get_dataset(slice), get_file_space(slice));
+}
+
+// Selects the union of `n` hyperslabs, `select(space_id, op, i)` selecting the
+// i-th one. Halves are merged recursively, as OR-ing many hyperslabs one by one
+// is quadratic in HDF5's span trees.
+template <typename F>
+inline void select_union(DataSpace& space, size_t begin, size_t end, const F& select) {
+#if H5_VERSION_GE(1, 10, 6)
+    if (end - begin > 8) {
+        const size_t middle = begin + (end - begin) / 2;
+        DataSpace upper = space.clone();
+        select_union(space, begin, middle, select);
+        select_union(upper, middle, end, select);
+        if (H5Smodify_select(space.getId(), H5S_SELECT_OR, upper.getId()) < 0) {
+            HDF5ErrMapper::ToException<DataSpaceException>("Unable to combine selections");
+        }
+        return;
+    }
+#endif
+    for (size_t i = begin; i < end; ++i) {
+        select(space.getId(), i == begin ? H5S_SELECT_SET : H5S_SELECT_OR, i);
+    }
+}
+
+// Columns selected out of file order are transferred through a buffer holding
+// the columns of the file selection, in increasing order, which is permuted
+// to or from the user buffer row by row.
+inline const std::vector<size_t>& get_column_order(const DataSet&) {
+    static const std::vector<size_t> in_file_order;
+    return in_file_order;
+}
+
+// Dimensions of the buffer of sorted columns, and of the rows of the selection
+template <typename Slice>
+inline std::vector<size_t> get_sorted_columns_dims(const Slice& slice,
+                                                   size_t& n_rows,
+                                                   size_t& n_columns) {
+    std::vector<size_t> dims = get_mem_space(slice).getDimensions();
+    n_rows = std::accumulate(dims.begin(), dims.end() - 1, size_t{1}, std::multiplies<size_t>());
+    n_columns = dims.back();
+    const hssize_t n_selected = H5Sget_select_npoints(get_file_space(slice).getId());
+    dims.back() = (n_rows == 0 || n_selected < 0) ? 0 : static_cast<size_t>(n_selected) / n_rows;
+    return dims;
+}
+
+template <typename Slice>
+inline void read_in_column_order(const Slice& slice,
+                                 void* array,
+                                 const DataType& mem_datatype,
+                                 hid_t xfer_id) {
+    const std::vector<size_t>& order = get_column_order(slice);
+    size_t n_rows, n_columns;
+    const std::vector<size_t> sorted_dims = get_sorted_columns_dims(slice, n_rows, n_columns);
+    const size_t n_sorted = sorted_dims.back();
+    if (n_rows * n_sorted == 0) {
+        return;
+    }
+    const size_t elem_size = mem_datatype.getSize();
+    std::vector<char, DefaultInitAllocator<char>> buffer(n_rows * n_sorted * elem_size);
+    if (H5Dread(get_dataset(slice).getId(), mem_datatype.getId(), DataSpace(sorted_dims).getId(),
+                get_file_space(slice).getId(), xfer_id, buffer.data()) < 0) {
+        HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Read: ");
+    }
+    char* dst = static_cast<char*>(array);
+    for (size_t row = 0; row < n_rows; ++row) {
+        const char* src = buffer.data() + row * n_sorted * elem_size;
+        for (size_t j = 0; j < n_columns; ++j, dst += elem_size) {
+            std::memcpy(dst, src + order[j] * elem_size, elem_size);
+        }
+    }
+}
+
+template <typename Slice>
+inline void write_in_column_order(const Slice& slice,
+                                  const void* array,
+                                  const DataType& mem_datatype,
+                                  hid_t xfer_id) {
+    const std::vector<size_t>& order = get_column_order(slice);
+    size_t n_rows, n_columns;
+    const std::vector<size_t> sorted_dims = get_sorted_columns_dims(slice, n_rows, n_columns);
+    const size_t n_sorted = sorted_dims.back();
+    if (n_rows * n_sorted == 0) {
+        return;
+    }
+    const size_t elem_size = mem_datatype.getSize();
+    std::vector<char, DefaultInitAllocator<char>> buffer(n_rows * n_sorted * elem_size);
+    const char* src = static_cast<const char*>(array);
+    for (size_t row = 0; row < n_rows; ++row) {
+        char* dst = buffer.data() + row * n_sorted * elem_size;
+        for (size_t j = 0; j < n_columns; ++j, src += elem_size) {
+            std::memcpy(dst + order[j] * elem_size, src, elem_size);
+        }
+    }
+    if (H5Dwrite(get_dataset(slice).getId(), mem_datatype.getId(), DataSpace(sorted_dims).getId(),
+                 get_file_space(slice).getId(), xfer_id, buffer.data()) < 0) {
+        HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Write: ");
+    }
+}
+
+// Columns selected in another order hold as many elements as their memory space
+template <typename Slice>
+inline void check_view_size(size_t view_size, const Slice& slice) {
+    const hssize_t n_selected =
+        get_column_order(slice).empty()
+            ? H5Sget_select_npoints(get_file_space(slice).getId())
+            : static_cast<hssize_t>(get_mem_space(slice).getElementCount());
+    if (n_selected < 0 || static_cast<size_t>(n_selected) != view_size) {
+        std::ostringstream ss;
+        ss << "Impossible to pair selection of " << n_selected
+           << " elements with an ArrayView of " << view_size << " elements";
+        throw DataSpaceException(ss.str());
+    }
+}
+
+// Hands a whole buffer to H5Dscatter
+inline herr_t scatter_buffer(const void** src_buf, size_t* src_buf_bytes_used, void* op_data) {
+    const auto& buffer = *static_cast<const std::vector<char, DefaultInitAllocator<char>>*>(op_data);
+    *src_buf = buffer.data();
+    *src_buf_bytes_used = buffer.size();
+    return 0;
+}
+
+// Large point selections are read by grouping the points by chunk (or by
+// blocks of rows when not chunked). The bounding box of a group dense enough
+// is read at once with a hyperslab, and its points gathered in memory; the
+// remaining points are read together as a point selection.
+static constexpr size_t gather_min_points = 64;
+// Largest bounding box read per point of a group
+static constexpr size_t gather_max_box_ratio = 16;
+static constexpr size_t gather_block_bytes = 1024 * 1024;
+
+// Copies the elements at `src_offsets` of `src` to the elements at
+// `dst_offsets` of `dst`. Common sizes are copied as words, in tight loops
+// the compiler can vectorize where gather instructions are available.
+template <typename Word>
+inline void gather_words(const char* src, const size_t* src_offsets,
+                         char* dst, const size_t* dst_offsets, size_t n) noexcept {
+    Word word;
+    for (size_t i = 0; i < n; ++i) {
+        std::memcpy(&word, src + src_offsets[i] * sizeof(Word), sizeof(Word));
+        std::memcpy(dst + dst_offsets[i] * sizeof(Word), &word, sizeof(Word));
+    }
+}
+
+inline void gather_elements(const char* src, const size_t* src_offsets,
+                            char* dst, const size_t* dst_offsets,
+                            size_t n, size_t elem_size) noexcept {
+    switch (elem_size) {
+    case 1:
+        return gather_words<uint8_t>(src, src_offsets, dst, dst_offsets, n);
+    case 2:
+        return gather_words<uint16_t>(src, src_offsets, dst, dst_offsets, n);
+    case 4:
+        return gather_words<uint32_t>(src, src_offsets, dst, dst_offsets, n);
+    case 8:
+        return gather_words<uint64_t>(src, src_offsets, dst, dst_offsets, n);
+    default:
+        for (size_t i = 0; i < n; ++i) {
+            std::memcpy(dst + dst_offsets[i] * elem_size, src + src_offsets[i] * elem_size,
+                        elem_size);
+        }
+    }
+}
+
+// Reads a point selection of the slice into `array` by bounding boxes.
+// Returns false to let the caller read the points through HDF5, when they are
+// few, too sparse or of variable length.
+template <typename Slice>
+inline bool read_gathered(const Slice& slice, void* array, const DataType& mem_datatype,
+                          hid_t xfer_id) {
+    const DataSpace& file_space = get_file_space(slice);
+    if (H5Sget_select_type(file_space.getId()) != H5S_SEL_POINTS) {
+        return false;
+    }
+    const hssize_t n_selected = H5Sget_select_npoints(file_space.getId());
+    if (n_selected < static_cast<hssize_t>(gather_min_points) || mem_datatype.isVariableStr() ||
+        H5Tdetect_class(mem_datatype.getId(), H5T_VLEN) > 0) {
+        return false;
+    }
+    const size_t n_points = static_cast<size_t>(n_selected);
+    const DataSet& dataset = get_dataset(slice);
+    const std::vector<size_t> dims = file_space.getDimensions();
+    const size_t rank = dims.size();
+    const size_t elem_size = mem_datatype.getSize();
+
+    std::vector<size_t> block_dims = get_chunk_dims(dataset);
+    if (block_dims.size() != rank) {
+        block_dims = dims;
+        const size_t row_bytes = std::accumulate(dims.begin() + 1, dims.end(), elem_size,
+                                                 std::multiplies<size_t>());
+        block_dims[0] = std::max(gather_block_bytes / std::max(row_bytes, size_t{1}), size_t{1});
+    }
+
+    std::vector<hsize_t> coords(n_points * rank);
+    if (H5Sget_select_elem_pointlist(file_space.getId(), 0, static_cast<hsize_t>(n_points),
+                                     coords.data()) < 0) {
+        HDF5ErrMapper::ToException<DataSpaceException>("Unable to get the selected points");
+    }
+
+    // Points sorted by block, as (block index, point index)
+    std::vector<std::pair<size_t, size_t>> blocks(n_points);
+    for (size_t i = 0; i < n_points; ++i) {
+        size_t block = 0;
+        for (size_t k = 0; k < rank; ++k) {
+            const size_t n_blocks = (dims[k] + block_dims[k] - 1) / block_dims[k];
+            block = block * n_blocks + static_cast<size_t>(coords[i * rank + k]) / block_dims[k];
+        }
+        blocks[i] = {block, i};
+    }
+    std::sort(blocks.begin(), blocks.end());
+
+    char* dst = static_cast<char*>(array);
+    std::vector<size_t> sparse, offsets, positions;
+    std::vector<char, DefaultInitAllocator<char>> buffer;
+    std::vector<hsize_t> box_start(rank), box_end(rank), box_count(rank);
+    DataSpace box_space = file_space.clone();
+    bool any_dense = false;
+
+    for (size_t first = 0; first < n_points;) {
+        size_t last = first;
+        while (last < n_points && blocks[last].first == blocks[first].first) {
+            ++last;
+        }
+        const size_t n_group = last - first;
+        const hsize_t* point = &coords[blocks[first].second * rank];
+        std::copy(point, point + rank, box_start.begin());
+        std::copy(point, point + rank, box_end.begin());
+        for (size_t i = first + 1; i < last; ++i) {
+            point = &coords[blocks[i].second * rank];
+            for (size_t k = 0; k < rank; ++k) {
+                box_start[k] = std::min(box_start[k], point[k]);
+                box_end[k] = std::max(box_end[k], point[k]);
+            }
+        }
+        size_t box_size = 1;
+        for (size_t k = 0; k < rank; ++k) {
+            box_count[k] = box_end[k] - box_start[k] + 1;
+            box_size *= static_cast<size_t>(box_count[k]);
+        }
+
+        if (n_group < 2 || box_size > gather_max_box_ratio * n_group) {
+            for (size_t i = first; i < last; ++i) {
+                sparse.push_back(blocks[i].second);
+            }
+            first = last;
+            continue;
+        }
+        any_dense = true;
+
+        buffer.resize(box_size * elem_size);
+        if (H5Sselect_hyperslab(box_space.getId(), H5S_SELECT_SET, box_start.data(), NULL,
+                                box_count.data(), NULL) < 0) {
+            HDF5ErrMapper::ToException<DataSpaceException>("Unable to select hyperslap");
+        }
+        if (H5Dread(dataset.getId(), mem_datatype.getId(), DataSpace(box_count.begin(), box_count.end()).getId(),
+                    box_space.getId(), xfer_id, buffer.data()) < 0) {
+            HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Read: ");
+        }
+        // Offsets of the points in the box and in the user buffer
+        offsets.resize(n_group);
+        positions.resize(n_group);
+        for (size_t i = first; i < last; ++i) {
+            point = &coords[blocks[i].second * rank];
+            size_t offset = 0;
+            for (size_t k = 0; k < rank; ++k) {
+                offset = offset * static_cast<size_t>(box_count[k]) +
+                         static_cast<size_t>(point[k] - box_start[k]);
+            }
+            offsets[i - first] = offset;
+            positions[i - first] = blocks[i].second;
+        }
+        gather_elements(buffer.data(), offsets.data(), dst, positions.data(), n_group, elem_size);
+        first = last;
+    }
+    if (!any_dense) {
+        return false;
+    }
+    if (sparse.empty()) {
+        return true;
+    }
+
+    std::vector<hsize_t> sparse_coords(sparse.size() * rank);
+    for (size_t i = 0; i < sparse.size(); ++i) {
+        std::copy(&coords[sparse[i] * rank], &coords[sparse[i] * rank] + rank,
+                  &sparse_coords[i * rank]);
+    }
+    if (H5Sselect_elements(box_space.getId(), H5S_SELECT_SET, sparse.size(),
+                           sparse_coords.data()) < 0) {
+        HDF5ErrMapper::ToException<DataSpaceException>("Unable to select elements");
+    }
+    buffer.resize(sparse.size() * elem_size);
+    if (H5Dread(dataset.getId(), mem_datatype.getId(), DataSpace(sparse.size()).getId(),
+                box_space.getId(), xfer_id, buffer.data()) < 0) {
+        HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Read: ");
+    }
+    offsets.resize(sparse.size());
+    std::iota(offsets.begin(), offsets.end(), size_t{0});
+    gather_elements(buffer.data(), offsets.data(), dst, sparse.data(), sparse.size(), elem_size);
+    return true;
+}
+
+// Bump allocator given to HDF5 as variable-length memory manager, so that the
+// strings of a read land in a few large blocks instead of one allocation each.
+class StringArena {
+  public:
+    using block_type = std::vector<char, DefaultInitAllocator<char>>;
+
+    inline StringArena(block_type&& first_block, size_t min_size)
+        : _used(0) {
+        _blocks.emplace_back(std::move(first_block));
+        _blocks.back().resize(std::max(_blocks.back().capacity(), min_size));
+    }
+
+    static void* allocate(size_t size, void* info) noexcept {
+        auto& arena = *static_cast<StringArena*>(info);
+        try {
+            if (arena._used + size > arena._blocks.back().size()) {
+                block_type block;
+                block.resize(std::max(2 * arena._blocks.back().size(), size));
+                arena._blocks.emplace_back(std::move(block));
+                arena._used = 0;
+            }
+        } catch (const std::bad_alloc&) {
+            return nullptr;
+        }
+        void* ptr = arena._blocks.back().data() + arena._used;
+        arena._used += size;
+        return ptr;
+    }
+
+    // Memory is owned by the arena
+    static void release(void*, void*) noexcept {}
+
+    // Fills the column from the string pointers set by H5Dread. If the strings
+    // were allocated in order in a single block, the block is adopted and
+    // trimmed to the strings it holds.
+    inline void collect(const std::vector<const char*>& strings, StringColumn& column) {
+        std::vector<size_t>& offsets = column._offsets;
+        offsets.resize(strings.size() + 1);
+        offsets[0] = 0;
+        const char* base = _blocks.front().data();
+        bool in_place = (_blocks.size() == 1);
+        for (size_t i = 0; i < strings.size(); ++i) {
+            in_place = in_place && strings[i] == base + offsets[i];
+            const size_t length = strings[i] ? std::strlen(strings[i]) : 0;
+            offsets[i + 1] = offsets[i] + length + 1;
+        }
+
+        if (in_place) {
+            column._chars = std::move(_blocks.front());
+            column._chars.resize(offsets.back());
+            column._chars.shrink_to_fit();
+            return;
+        }
+        column._chars.resize(offsets.back());
+        for (size_t i = 0; i < strings.size(); ++i) {
+            const size_t length = offsets[i + 1] - offsets[i] - 1;
+            if (length > 0) {
+                std::memcpy(&column._chars[offsets[i]], strings[i], length);
+            }
+            column._chars[offsets[i] + length] = '\0';
+        }
+    }
+
+  private:
+    std::vector<block_type> _blocks;
+    size_t _used;
+};
+
+// Upper bound of the intermediate buffer used to transfer nested vectors.
+// Rows larger than this are transferred one by one, and 2D ones directly
+// from/to the leaf vectors, without any intermediate copy.
+static constexpr size_t nested_vector_block_bytes = 4 * 1024 * 1024;
+
+// Expresses the file selection as a regular hyperslab (offset/stride/count/block)
+// matching the memory dimensions, in which the first dimension has unit blocks.
+// Returns false if no such description exists (e.g. point or column selections),
+// in which case rows can't be addressed independently.
+inline bool get_row_hyperslab(const DataSpace& file_space,
+                              const std::vector<size_t>& mem_dims,
+                              std::vector<hsize_t>& start,
+                              std::vector<hsize_t>& stride,
+                              std::vector<hsize_t>& count,
+                              std::vector<hsize_t>& block) {
+    const hid_t space_id = file_space.getId();
+    const size_t n_dims = file_space.getNumberDimensions();
+    if (mem_dims.empty() || n_dims != mem_dims.size()) {
+        return false;
+    }
+    start.assign(n_dims, 0);
+    stride.assign(n_dims, 1);
+    block.assign(n_dims, 1);
+    count.resize(n_dims);
+
+    const H5S_sel_type sel_type = H5Sget_select_type(space_id);
+    if (sel_type == H5S_SEL_ALL) {
+        if (H5Sget_simple_extent_dims(space_id, count.data(), NULL) < 0) {
+            return false;
+        }
+    } else if (sel_type == H5S_SEL_HYPERSLABS) {
+#if H5_VERSION_GE(1, 10, 0)
+        if (H5Sis_regular_hyperslab(space_id) <= 0 ||
+            H5Sget_regular_hyperslab(space_id, start.data(), stride.data(),
+                                     count.data(), block.data()) < 0) {
+            return false;
+        }
+#else
+        return false;
+#endif
+    } else {
+        return false;
+    }
+
+    // Contiguous first dimension: a single block is equivalent to unit blocks
+    if (block[0] != 1) {
+        if (count[0] != 1 && stride[0] != block[0]) {
+            return false;
+        }
+        count[0] *= block[0];
+        stride[0] = block[0] = 1;
+    }
+    for (size_t i = 0; i < n_dims; ++i) {
+        if (count[i] * block[i] != mem_dims[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Calls `func(first_row, n_rows, mem_space, file_space)` for consecutive blocks
+// of rows (first dimension) of the selection, each holding at most
+// `rows_per_block` rows. Returns false, without calling `func`, if the
+// selection rows can't be addressed independently.
+template <typename Slice, typename F>
+inline bool for_each_row_block(const Slice& slice,
+                               const std::vector<size_t>& mem_dims,
+                               size_t rows_per_block,
+                               F&& func) {
+    std::vector<hsize_t> start, stride, count, block;
+    DataSpace file_space = details::get_file_space(slice).clone();
+    if (!get_row_hyperslab(file_space, mem_dims, start, stride, count, block)) {
+        return false;
+    }
+
+    const hsize_t first_start = start[0];
+    std::vector<size_t> block_dims(mem_dims);
+    block_dims[0] = std::min(rows_per_block, mem_dims[0]);
+    DataSpace mem_space(block_dims);
+
+    for (size_t row = 0; row < mem_dims[0]; row += block_dims[0]) {
+        const size_t n_rows = std::min(block_dims[0], mem_dims[0] - row);
+        if (n_rows != block_dims[0]) {
+            block_dims[0] = n_rows;
+            mem_space = DataSpace(block_dims);
+        }
+        start[0] = first_start + row * stride[0];
+        count[0] = n_rows;
+        if (H5Sselect_hyperslab(file_space.getId(), H5S_SELECT_SET, start.data(),
+                                stride.data(), count.data(), block.data()) < 0) {
+            HDF5ErrMapper::ToException<DataSpaceException>("Unable to select hyperslap");
+        }
+        func(row, n_rows, mem_space.getId(), file_space.getId());
+    }
+    return true;
+}
+
+inline size_t rows_per_nested_block(const std::vector<size_t>& dims, size_t elem_size) {
+    const size_t row_bytes = compute_total_size(dims) / std::max(dims[0], size_t{1}) * elem_size;
+    return row_bytes == 0 ? std::max(dims[0], size_t{1})
+                          : std::max(nested_vector_block_bytes / row_bytes, size_t{1});
+}
+
+// Nested vectors are read and written row-block by row-block, bounding the size
+// of the intermediate buffer, instead of going through a full-size aligned copy.
+// The generic versions signal the caller to take the regular path.
+template <typename Slice, typename T>
+inline bool read_rows(const Slice&, T&, const DataSpace&, const DataType&, hid_t) {
+    return false;
+}
+
+template <typename Slice, typename T>
+inline bool write_rows(const Slice&, const T&, const DataSpace&, const DataType&, hid_t) {
+    return false;
+}
+
+template <typename Slice, typename T, typename Allocator>
+inline typename std::enable_if<is_container<T>::value, bool>::type
+read_rows(const Slice& slice,
+          std::vector<T, Allocator>& vec,
+          const DataSpace& mem_space,
+          const DataType& mem_type,
+          hid_t xfer_id) {
+    using value_type = typename type_of_array<T>::type;
+    const std::vector<size_t> dims = mem_space.getDimensions();
+    if (std::is_same<value_type, std::string>::value ||
+        dims.size() != array_dims<std::vector<T, Allocator>>::value) {
+        return false;
+    }
+    const size_t rows_per_block = rows_per_nested_block(dims, sizeof(value_type));
+    const bool direct = (rows_per_block == 1 && dims.size() == 2);
+    const hid_t dataset_id = get_dataset(slice).getId();
+    std::vector<value_type, DefaultInitAllocator<value_type>> buffer;
+
+    auto read_block = [&](size_t row, size_t n_rows, hid_t mem_id, hid_t file_id) {
+        void* dst;
+        if (direct) {
+            vec[row].resize(dims[1]);
+            dst = vec[row].data();
+        } else {
+            buffer.resize(n_rows * compute_total_size(dims) / dims[0]);
+            dst = buffer.data();
+        }
+        if (H5Dread(dataset_id, mem_type.getId(), mem_id, file_id, xfer_id, dst) < 0) {
+            HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Read: ");
+        }
+        if (!direct) {
+            auto it = buffer.cbegin();
+            for (size_t i = row; i < row + n_rows; ++i) {
+                it = single_buffer_to_vectors(it, buffer.cend(), dims, 1, vec[i]);
+            }
+        }
+    };
+
+    vec.resize(dims[0]);
+    return for_each_row_block(slice, dims, rows_per_block, read_block);
+}
+
+template <typename Slice, typename T, typename Allocator>
+inline typename std::enable_if<is_container<T>::value, bool>::type
+write_rows(const Slice& slice,
+           const std::vector<T, Allocator>& vec,
+           const DataSpace& mem_space,
+           const DataType& mem_type,
+           hid_t xfer_id) {
+    using value_type = typename type_of_array<T>::type;
+    const std::vector<size_t> dims = mem_space.getDimensions();
+    if (std::is_same<value_type, std::string>::value ||
+        dims.size() != array_dims<std::vector<T, Allocator>>::value) {
+        return false;
+    }
+    check_dimensions_vector(vec.size(), dims[0], 0);
+    const size_t rows_per_block = rows_per_nested_block(dims, sizeof(value_type));
+    const bool direct = (rows_per_block == 1 && dims.size() == 2);
+    const hid_t dataset_id = get_dataset(slice).getId();
+    std::vector<value_type, DefaultInitAllocator<value_type>> buffer;
+
+    auto write_block = [&](size_t row, size_t n_rows, hid_t mem_id, hid_t file_id) {
+        const void* src;
+        if (direct) {
+            check_dimensions_vector(vec[row].size(), dims[1], 1);
+            src = vec[row].data();
+        } else {
+            buffer.clear();
+            for (size_t i = row; i < row + n_rows; ++i) {
+                vectors_to_single_buffer(vec[i], dims, 1, buffer);
+            }
+            src = buffer.data();
+        }
+        if (H5Dwrite(dataset_id, mem_type.getId(), mem_id, file_id, xfer_id, src) < 0) {
+            HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Write: ");
+        }
+    };
+
+    return for_each_row_block(slice, dims, rows_per_block, write_block);
+}
+
+// Numeric conversions done by HighFive instead of HDF5's generic converters:
+// the selection is read in the native type of the file, by blocks of bounded
+// size (any byte swapping being done by HDF5), and each block is converted by a
+// plain loop which the compiler vectorizes. Only conversions which never
+// overflow are handled, the other ones having saturating semantics in HDF5.
+// Define H5_NO_NUMERIC_CONVERSION to always let HDF5 convert.
+static constexpr size_t conversion_block_bytes = 1024 * 1024;
+
+template <typename Src, typename Dst>
+struct is_safe_conversion {
+    static constexpr bool value =
+        !std::is_same<Src, Dst>::value &&
+        (std::is_floating_point<Dst>::value
+             // integers are in range of any floating point type, narrowing
+             // floating point types could overflow
+             ? std::is_integral<Src>::value || sizeof(Src) <= sizeof(Dst)
+             : std::is_integral<Src>::value && std::is_integral<Dst>::value &&
+                   (std::is_signed<Src>::value == std::is_signed<Dst>::value
+                        ? sizeof(Src) <= sizeof(Dst)
+                        : std::is_unsigned<Src>::value && sizeof(Src) < sizeof(Dst)));
+};
+
+template <typename Src, typename Dst>
+inline void convert_numbers(const Src* src, Dst* dst, size_t n) noexcept {
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = static_cast<Dst>(src[i]);
+    }
+}
+
+template <typename Src, typename Slice, typename Dst>
+inline typename std::enable_if<!is_safe_conversion<Src, Dst>::value, bool>::type
+read_converting(const Slice&, Dst*, hid_t) {
+    return false;
+}
+
+template <typename Src, typename Slice, typename Dst>
+inline typename std::enable_if<is_safe_conversion<Src, Dst>::value, bool>::type
+read_converting(const Slice& slice, Dst* array, hid_t xfer_id) {
+    const std::vector<size_t> dims = get_mem_space(slice).getDimensions();
+    const size_t n_elements = compute_total_size(dims);
+    if (n_elements == 0) {
+        return false;
+    }
+    const size_t n_rows = dims.empty() ? 1 : dims[0];
+    const size_t row_size = n_elements / n_rows;
+    const hid_t dataset_id = get_dataset(slice).getId();
+    const hid_t src_type_id = cached_datatype<Src>().getId();
+    std::vector<Src, DefaultInitAllocator<Src>> buffer;
+
+    auto read_block = [&](size_t row, size_t block_rows, hid_t mem_id, hid_t file_id) {
+        buffer.resize(block_rows * row_size);
+        if (H5Dread(dataset_id, src_type_id, mem_id, file_id, xfer_id, buffer.data()) < 0) {
+            HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Read: ");
+        }
+        convert_numbers(buffer.data(), array + row * row_size, buffer.size());
+    };
+
+    if (n_elements * sizeof(Src) <= conversion_block_bytes) {
+        read_block(0, n_rows, get_memspace_id(slice), get_file_space(slice).getId());
+        return true;
+    }
+    const size_t rows_per_block =
+        std::max(conversion_block_bytes / (row_size * sizeof(Src)), size_t{1});
+    return for_each_row_block(slice, dims, rows_per_block, read_block);
+}
+
+// Whether a floating point type has the same layout as a native one
+inline bool is_float_format(hid_t type_id, hid_t native_id) {
+    size_t fields[5], native_fields[5];
+    if (H5Tget_fields(type_id, &fields[0], &fields[1], &fields[2], &fields[3], &fields[4]) < 0 ||
+        H5Tget_fields(native_id, &native_fields[0], &native_fields[1], &native_fields[2],
+                      &native_fields[3], &native_fields[4]) < 0) {
+        return false;
+    }
+    return std::equal(fields, fields + 5, native_fields) &&
+           H5Tget_ebias(type_id) == H5Tget_ebias(native_id);
+}
+
+// Whether a transfer property list has a data transform. HDF5 reports a
+// missing transform as an error, which is kept quiet.
+inline bool has_data_transform(hid_t xfer_id) {
+    if (xfer_id == H5P_DEFAULT) {
+        return false;
+    }
+    SilenceHDF5 silence;
+    const ssize_t length = H5Pget_data_transform(xfer_id, NULL, 0);
+    if (length < 0) {
+        H5Eclear2(H5E_DEFAULT);
+    }
+    return length > 0;
+}
+
+template <typename T>
+struct is_number {
+    static constexpr bool value = std::is_arithmetic<T>::value &&
+                                  !std::is_same<T, bool>::value;
+};
+
+// Calls visitor.apply<Src>() with Src the native type having the layout of
+// the numbers of a file type. Returns false if there is none.
+template <typename Visitor>
+inline bool visit_native_number(hid_t file_type_id, const Visitor& visitor) {
+    const size_t size = H5Tget_size(file_type_id);
+    switch (H5Tget_class(file_type_id)) {
+    case H5T_INTEGER: {
+        if (H5Tget_precision(file_type_id) != 8 * size || H5Tget_offset(file_type_id) != 0) {
+            return false;
+        }
+        const bool is_signed = (H5Tget_sign(file_type_id) == H5T_SGN_2);
+        switch (size) {
+        case 1:
+            return is_signed ? visitor.template apply<int8_t>()
+                             : visitor.template apply<uint8_t>();
+        case 2:
+            return is_signed ? visitor.template apply<int16_t>()
+                             : visitor.template apply<uint16_t>();
+        case 4:
+            return is_signed ? visitor.template apply<int32_t>()
+                             : visitor.template apply<uint32_t>();
+        case 8:
+            return is_signed ? visitor.template apply<int64_t>()
+                             : visitor.template apply<uint64_t>();
+        default:
+            return false;
+        }
+    }
+    case H5T_FLOAT:
+        if (size == sizeof(float) && is_float_format(file_type_id, H5T_NATIVE_FLOAT)) {
+            return visitor.template apply<float>();
+        }
+        if (size == sizeof(double) && is_float_format(file_type_id, H5T_NATIVE_DOUBLE)) {
+            return visitor.template apply<double>();
+        }
+        return false;
+    default:
+        return false;
+    }
+}
+
+template <typename Slice, typename Dst>
+struct ConvertingReader {
+    const Slice& slice;
+    Dst* array;
+    hid_t xfer_id;
+
+    template <typename Src>
+    bool apply() const {
+        return read_converting<Src>(slice, array, xfer_id);
+    }
+};
+
+// Reads the selection into `array` with HighFive's conversions if the file and
+// memory types allow it. Returns false to let the caller read through HDF5.
+template <typename Slice, typename T>
+inline typename std::enable_if<!is_number<T>::value, bool>::type
+read_converted(const Slice&, T*, const DataType&, hid_t) {
+    return false;
+}
+
+template <typename Slice, typename Dst>
+inline typename std::enable_if<is_number<Dst>::value, bool>::type
+read_converted(const Slice& slice, Dst* array, const DataType& mem_datatype, hid_t xfer_id) {
+#ifdef H5_NO_NUMERIC_CONVERSION
+    (void)slice;
+    (void)array;
+    (void)mem_datatype;
+    (void)xfer_id;
+    return false;
+#else
+    // Data transforms apply to the memory type, let HDF5 convert
+    if (mem_datatype.getId() != cached_datatype<Dst>().getId() || has_data_transform(xfer_id)) {
+        return false;
+    }
+    const DataType file_datatype = get_file_datatype(slice);
+    return visit_native_number(file_datatype.getId(),
+                               ConvertingReader<Slice, Dst>{slice, array, xfer_id});
+#endif
+}
+
+// Reads the selection into `array`, through the column order, the gathering
+// of points, HighFive's conversions or H5Dread. Returns whether HighFive
+// converted the numbers, HDF5 converting otherwise.
+template <typename Slice, typename T>
+inline bool read_selection(const Slice& slice,
+                           T* array,
+                           const DataType& mem_datatype,
+                           hid_t xfer_id) {
+    using element_type = typename type_of_array<T>::type;
+
+    record_chunk_access(slice);
+    const std::vector<size_t>& column_order = get_column_order(slice);
+    if (!column_order.empty()) {
+        // Repeated variable-length elements would be released twice
+        const bool repeated = *std::max_element(column_order.begin(), column_order.end()) + 1 !=
+                              column_order.size();
+        if (repeated && (mem_datatype.isVariableStr() ||
+                         H5Tdetect_class(mem_datatype.getId(), H5T_VLEN) > 0)) {
+            throw DataSpaceException("Impossible to read repeated columns of variable-length data");
+        }
+        read_in_column_order(slice, static_cast<void*>(array), mem_datatype, xfer_id);
+        return false;
+    }
+    if (read_gathered(slice, static_cast<void*>(array), mem_datatype, xfer_id)) {
+        return false;
+    }
+    if (read_converted(slice, reinterpret_cast<element_type*>(array), mem_datatype, xfer_id)) {
+        return true;
+    }
+    if (H5Dread(get_dataset(slice).getId(), mem_datatype.getId(), get_memspace_id(slice),
+                get_file_space(slice).getId(), xfer_id, static_cast<void*>(array)) < 0) {
+        HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Read: ");
+    }
+    return false;
+}
+
 }  // namespace details
 
 inline ElementSet::ElementSet(std::initializer_list<std::size_t> list)
@@ -71,6 +886,137 @@ inline ElementSet::ElementSet(const std::vector<std::vector<std::size_t>>& eleme
     }
 }
 
+inline RegularHyperSlab::RegularHyperSlab(const std::vector<size_t>& offset_,
+                                          const std::vector<size_t>& count_,
+                                          const std::vector<size_t>& stride_,
+                                          const std::vector<size_t>& block_)
+    : offset(offset_)
+    , count(count_)
+    , stride(stride_.empty() ? std::vector<size_t>(offset_.size(), 1) : stride_)
+    , block(block_.empty() ? std::vector<size_t>(offset_.size(), 1) : block_) {
+    if (count.size() != rank() || stride.size() != rank() || block.size() != rank()) {
+        throw DataSpaceException("Offset, count, stride and block of a hyperslab "
+                                 "must have the same number of dimensions");
+    }
+}
+
+inline std::vector<size_t> RegularHyperSlab::packedDims() const {
+    std::vector<size_t> dims(rank());
+    for (size_t i = 0; i < rank(); ++i) {
+        dims[i] = count[i] * block[i];
+    }
+    return dims;
+}
+
+inline HyperSlab::HyperSlab(const RegularHyperSlab& slab) {
+    add(slab, Op::Set);
+}
+
+inline HyperSlab& HyperSlab::add(const RegularHyperSlab& slab, Op op) {
+    _operations.emplace_back(slab, op);
+    return *this;
+}
+
+inline HyperSlab& HyperSlab::operator|=(const RegularHyperSlab& slab) {
+    return add(slab, Op::Or);
+}
+
+inline HyperSlab& HyperSlab::operator&=(const RegularHyperSlab& slab) {
+    return add(slab, Op::And);
+}
+
+inline HyperSlab& HyperSlab::operator^=(const RegularHyperSlab& slab) {
+    return add(slab, Op::Xor);
+}
+
+inline HyperSlab& HyperSlab::notB(const RegularHyperSlab& slab) {
+    return add(slab, Op::NotB);
+}
+
+inline HyperSlab& HyperSlab::notA(const RegularHyperSlab& slab) {
+    return add(slab, Op::NotA);
+}
+
+inline HyperSlab HyperSlab::operator|(const RegularHyperSlab& slab) const {
+    return HyperSlab(*this) |= slab;
+}
+
+inline HyperSlab HyperSlab::operator&(const RegularHyperSlab& slab) const {
+    return HyperSlab(*this) &= slab;
+}
+
+inline HyperSlab HyperSlab::operator^(const RegularHyperSlab& slab) const {
+    return HyperSlab(*this) ^= slab;
+}
+
+inline DataSpace HyperSlab::apply(const DataSpace& space) const {
+    DataSpace selected = space.clone();
+    H5Sselect_none(selected.getId());
+
+    auto select_slab = [this](hid_t space_id, H5S_seloper_t op, size_t i) {
+        const RegularHyperSlab& slab = _operations[i].first;
+        const std::vector<hsize_t> offset(slab.offset.begin(), slab.offset.end());
+        const std::vector<hsize_t> stride(slab.stride.begin(), slab.stride.end());
+        const std::vector<hsize_t> count(slab.count.begin(), slab.count.end());
+        const std::vector<hsize_t> block(slab.block.begin(), slab.block.end());
+        if (H5Sselect_hyperslab(space_id, op, offset.data(), stride.data(), count.data(),
+                                block.data()) < 0) {
+            HDF5ErrMapper::ToException<DataSpaceException>("Unable to select hyperslap");
+        }
+    };
+
+    for (size_t i = 0; i < _operations.size();) {
+        H5S_seloper_t op = H5S_SELECT_NOOP;
+        switch (_operations[i].second) {
+        case Op::Set:
+            op = H5S_SELECT_SET;
+            break;
+        case Op::Or:
+            op = H5S_SELECT_OR;
+            break;
+        case Op::And:
+            op = H5S_SELECT_AND;
+            break;
+        case Op::Xor:
+            op = H5S_SELECT_XOR;
+            break;
+        case Op::NotB:
+            op = H5S_SELECT_NOTB;
+            break;
+        case Op::NotA:
+            op = H5S_SELECT_NOTA;
+            break;
+        }
+        if (op != H5S_SELECT_OR) {
+            select_slab(selected.getId(), op, i++);
+            continue;
+        }
+
+        // Consecutive unions are merged together first
+        size_t end = i + 1;
+        while (end < _operations.size() && _operations[end].second == Op::Or) {
+            ++end;
+        }
+        if (H5Sget_select_npoints(selected.getId()) == 0) {
+            details::select_union(selected, i, end, select_slab);
+        } else {
+#if H5_VERSION_GE(1, 10, 6)
+            DataSpace unioned = space.clone();
+            details::select_union(unioned, i, end, select_slab);
+            if (H5Smodify_select(selected.getId(), H5S_SELECT_OR, unioned.getId()) < 0) {
+                HDF5ErrMapper::ToException<DataSpaceException>("Unable to combine selections");
+            }
+#else
+            for (size_t j = i; j < end; ++j) {
+                select_slab(selected.getId(), H5S_SELECT_OR, j);
+            }
+#endif
+        }
+        i = end;
+    }
+    return selected;
+}
+
 template <typename Derivate>
 inline Selection SliceTraits<Derivate>::select(const std::vector<size_t>& offset,
                                                const std::vector<size_t>& count,
@@ -85,7 +1031,7 @@ inline Selection SliceTraits<Derivate>::select(const std::vector<size_t>& offset
     std::copy(count.begin(), count.end(), count_local.begin());
     std::copy(stride.begin(), stride.end(), stride_local.begin());
 
-    DataSpace space = slice.getSpace().clone();
+    DataSpace space = details::get_file_space(slice).clone();
     if (H5Sselect_hyperslab(space.getId(), H5S_SELECT_SET, offset_local.data(),
                             stride.empty() ? NULL : stride_local.data(),
                             count_local.data(), NULL) < 0) {
@@ -98,34 +1044,111 @@ inline Selection SliceTraits<Derivate>::select(const std::vector<size_t>& offset
 template <typename Derivate>
 inline Selection SliceTraits<Derivate>::select(const std::vector<size_t>& columns) const {
     const auto& slice = static_cast<const Derivate&>(*this);
-    const DataSpace& space = slice.getSpace();
+    DataSpace space = details::get_file_space(slice).clone();
     const DataSet& dataset = details::get_dataset(slice);
     std::vector<size_t> dims = space.getDimensions();
-    std::vector<hsize_t> counts(dims.size());
-    std::copy(dims.begin(), dims.end(), counts.begin());
-    counts[dims.size() - 1] = 1;
-    std::vector<hsize_t> offsets(dims.size(), 0);
+    if (dims.empty()) {
+        throw DataSpaceException("Column selection requires a dataset of rank >= 1");
+    }
 
-    H5Sselect_none(space.getId());
+    std::vector<size_t> sorted(columns);
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
 
-    for (const auto& column : columns) {
-        offsets[offsets.size() - 1] = column;
+    // Runs of contiguous columns, as (first column, length)
+    std::vector<std::pair<size_t, size_t>> runs;
+    for (const auto& column : sorted) {
+        if (!runs.empty() && runs.back().first + runs.back().second == column) {
+            ++runs.back().second;
+        } else {
+            runs.emplace_back(column, 1);
+        }
+    }
 
-        if (H5Sselect_hyperslab(space.getId(), H5S_SELECT_OR, offsets.data(), 0,
-                                counts.data(), 0) < 0) {
+    // Leading dimensions as a single block: HDF5 merges such hyperslabs far
+    // faster than ones made of unit blocks
+    std::vector<hsize_t> offsets(dims.size(), 0);
+    std::vector<hsize_t> strides(dims.size(), 1);
+    std::vector<hsize_t> counts(dims.size(), 1);
+    std::vector<hsize_t> blocks(dims.begin(), dims.end());
+    for (size_t i = 0; i + 1 < dims.size(); ++i) {
+        if (dims[i] == 0) {
+            counts[i] = 0;
+            blocks[i] = 1;
+        }
+    }
+
+    // Runs of the same length at a constant spacing make a single hyperslab,
+    // given as (first run, number of runs, spacing)
+    std::vector<std::tuple<size_t, size_t, size_t>> slabs;
+    for (size_t i = 0; i < runs.size();) {
+        size_t n_runs = 1;
+        const size_t spacing = (i + 1 < runs.size()) ? runs[i + 1].first - runs[i].first : 1;
+        while (i + n_runs < runs.size() && runs[i + n_runs].second == runs[i].second &&
+               runs[i + n_runs].first - runs[i + n_runs - 1].first == spacing) {
+            ++n_runs;
+        }
+        slabs.emplace_back(i, n_runs, n_runs > 1 ? spacing : 1);
+        i += n_runs;
+    }
+
+    auto select_slab = [&](hid_t space_id, H5S_seloper_t op, size_t i) {
+        const auto& run = runs[std::get<0>(slabs[i])];
+        offsets.back() = run.first;
+        strides.back() = std::get<2>(slabs[i]);
+        counts.back() = std::get<1>(slabs[i]);
+        blocks.back() = run.second;
+        if (H5Sselect_hyperslab(space_id, op, offsets.data(), strides.data(), counts.data(),
+                                blocks.data()) < 0) {
             HDF5ErrMapper::ToException<DataSpaceException>("Unable to select hyperslap");
         }
+    };
+    H5Sselect_none(space.getId());
+    details::select_union(space, 0, slabs.size(), select_slab);
+
+    dims.back() = columns.size();
+    Selection selection(DataSpace(dims), space, dataset);
+    if (columns.size() != sorted.size() ||
+        !std::equal(columns.begin(), columns.end(), sorted.begin())) {
+        selection._column_order.reserve(columns.size());
+        for (const auto& column : columns) {
+            selection._column_order.push_back(static_cast<size_t>(
+                std::lower_bound(sorted.begin(), sorted.end(), column) - sorted.begin()));
+        }
     }
+    return selection;
+}
+
+template <typename Derivate>
+inline Selection SliceTraits<Derivate>::select(const HyperSlab& hyperslab) const {
+    const auto& slice = static_cast<const Derivate&>(*this);
+    const DataSpace space = hyperslab.apply(details::get_file_space(slice));
+    const auto& operations = hyperslab._operations;
+    if (operations.size() == 1 && operations[0].second == HyperSlab::Op::Set) {
+        return Selection(DataSpace(operations[0].first.packedDims()), space,
+                         details::get_dataset(slice));
+    }
+    const hssize_t n_selected = H5Sget_select_npoints(space.getId());
+    if (n_selected < 0) {
+        HDF5ErrMapper::ToException<DataSpaceException>("Unable to count the selected elements");
+    }
+    return Selection(DataSpace(static_cast<size_t>(n_selected)), space,
+                     details::get_dataset(slice));
+}
 
-    dims[dims.size() - 1] = columns.size();
-    return Selection(DataSpace(dims), space, dataset);
+template <typename Derivate>
+inline Selection SliceTraits<Derivate>::select(const HyperSlab& hyperslab,
+                                               const DataSpace& memspace) const {
+    const auto& slice = static_cast<const Derivate&>(*this);
+    return Selection(memspace, hyperslab.apply(details::get_file_space(slice)),
+                     details::get_dataset(slice));
 }
 
 template <typename Derivate>
 inline Selection SliceTraits<Derivate>::select(const ElementSet& elements) const {
     const auto& slice = static_cast<const Derivate&>(*this);
     const hsize_t* data = nullptr;
-    const DataSpace space = slice.getSpace().clone();
+    const DataSpace space = details::get_file_space(slice).clone();
     const std::size_t length = elements._ids.size();
     if (length % space.getNumberDimensions() != 0) {
         throw DataSpaceException("Number of coordinates in elements picking "
@@ -155,10 +1178,12 @@ inline Selection SliceTraits<Derivate>::select(const ElementSet& elements) const
 
 template <typename Derivate>
 template <typename T>
-inline void SliceTraits<Derivate>::read(T& array) const {
+inline void SliceTraits<Derivate>::read(T& array, const DataTransferProps& xfer_props) const {
     const auto& slice = static_cast<const Derivate&>(*this);
-    const DataSpace& mem_space = slice.getMemSpace();
-    const details::BufferInfo<T> buffer_info(slice.getDataType());
+    const DataSpace& mem_space = details::get_mem_space(slice);
+    const DataType file_datatype = details::get_file_datatype(slice);
+    // Warnings depend on the path taken, HighFive converting some reads itself
+    const details::BufferInfo<T> buffer_info(file_datatype, false);
 
     if (!details::checkDimensions(mem_space, buffer_info.n_dimensions)) {
         std::ostringstream ss;
@@ -167,8 +1192,19 @@ inline void SliceTraits<Derivate>::read(T& array) const {
            << buffer_info.n_dimensions;
         throw DataSpaceException(ss.str());
     }
+    const bool in_file_order = details::get_column_order(slice).empty();
+    if (in_file_order &&
+        details::read_rows(slice, array, mem_space, buffer_info.data_type,
+                           xfer_props.getId())) {
+        details::warn_type_mismatch(buffer_info.data_type, file_datatype);
+        details::record_chunk_access(slice);
+        return;
+    }
     details::data_converter<T> converter(mem_space);
-    read(converter.transform_read(array), buffer_info.data_type);
+    if (!details::read_selection(slice, converter.transform_read(array),
+                                 buffer_info.data_type, xfer_props.getId())) {
+        details::warn_type_mismatch(buffer_info.data_type, file_datatype);
+    }
     // re-arrange results
     converter.process_result(array);
 }
@@ -176,31 +1212,112 @@ inline void SliceTraits<Derivate>::read(T& array) const {
 
 template <typename Derivate>
 template <typename T>
-inline void SliceTraits<Derivate>::read(T* array, const DataType& dtype) const {
+inline void SliceTraits<Derivate>::read(T* array,
+                                         const DataType& dtype,
+                                         const DataTransferProps& xfer_props) const {
     static_assert(!std::is_const<T>::value,
                   "read() requires a non-const structure to read data into");
-    const auto& slice = static_cast<const Derivate&>(*this);
     using element_type = typename details::type_of_array<T>::type;
 
     // Auto-detect mem datatype if not provided
     const DataType& mem_datatype =
-            dtype.empty() ? create_and_check_datatype<element_type>() : dtype;
+            dtype.empty() ? details::cached_checked_datatype<element_type>() : dtype;
+    details::read_selection(static_cast<const Derivate&>(*this), array, mem_datatype,
+                            xfer_props.getId());
+}
+
+
+template <typename Derivate>
+template <typename T, std::size_t N>
+inline void SliceTraits<Derivate>::read(ArrayView<T, N> view,
+                                         const DataType& dtype,
+                                         const DataTransferProps& xfer_props) const {
+    static_assert(!std::is_const<T>::value,
+                  "read() requires a view of non-const elements to read data into");
+    const auto& slice = static_cast<const Derivate&>(*this);
+    const DataSpace file_space = details::get_file_space(slice);
+    details::check_view_size(view.getElementCount(), slice);
+    const DataType& mem_datatype =
+            dtype.empty() ? details::cached_checked_datatype<T>() : dtype;
 
+    details::record_chunk_access(slice);
+    if (!details::get_column_order(slice).empty()) {
+        std::vector<char, DefaultInitAllocator<char>> buffer(view.getElementCount() *
+                                                             mem_datatype.getSize());
+        details::read_in_column_order(slice, buffer.data(), mem_datatype, xfer_props.getId());
+        if (H5Dscatter(&details::scatter_buffer, static_cast<void*>(&buffer),
+                       mem_datatype.getId(), view.getMemSpace().getId(),
+                       static_cast<void*>(view.data())) < 0) {
+            HDF5ErrMapper::ToException<DataSpaceException>("Unable to scatter to the view");
+        }
+        return;
+    }
     if (H5Dread(details::get_dataset(slice).getId(),
                 mem_datatype.getId(),
-                details::get_memspace_id(slice),
-                slice.getSpace().getId(), H5P_DEFAULT, static_cast<void*>(array)) < 0) {
+                view.getMemSpace().getId(),
+                file_space.getId(), xfer_props.getId(), static_cast<void*>(view.data())) < 0) {
         HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Read: ");
     }
 }
 
 
+template <typename Derivate>
+inline void SliceTraits<Derivate>::read(StringColumn& column,
+                                         const DataTransferProps& xfer_props) const {
+    const auto& slice = static_cast<const Derivate&>(*this);
+    if (!details::get_file_datatype(slice).isVariableStr()) {
+        throw DataSetException("StringColumn can only be read from variable-length strings");
+    }
+    const size_t n_strings = details::get_mem_space(slice).getElementCount();
+
+    // Reuse the column storage, sized from the stored string lengths. Column
+    // selections may repeat columns, so they start from an estimate instead.
+    size_t arena_size = 32 * n_strings;
+    if (details::get_column_order(slice).empty()) {
+        hsize_t total_size = 0;
+        SilenceHDF5 silence;
+        if (H5Dvlen_get_buf_size(details::get_dataset(slice).getId(),
+                                 details::cached_datatype<std::string>().getId(),
+                                 details::get_file_space(slice).getId(), &total_size) >= 0) {
+            arena_size = static_cast<size_t>(total_size);
+        } else {
+            H5Eclear2(H5E_DEFAULT);
+        }
+    }
+    details::StringArena arena(std::move(column._chars), arena_size);
+    RawPropertyList<PropertyType::DATASET_XFER> arena_props(xfer_props);
+    arena_props.add(H5Pset_vlen_mem_manager,
+                    &details::StringArena::allocate, static_cast<void*>(&arena),
+                    &details::StringArena::release, static_cast<void*>(nullptr));
+
+    std::vector<const char*> strings(n_strings, nullptr);
+    details::record_chunk_access(slice);
+    try {
+        if (!details::get_column_order(slice).empty()) {
+            details::read_in_column_order(slice, static_cast<void*>(strings.data()),
+                                          details::cached_datatype<std::string>(),
+                                          arena_props.getId());
+        } else if (H5Dread(details::get_dataset(slice).getId(),
+                           details::cached_datatype<std::string>().getId(),
+                           details::get_memspace_id(slice),
+                           details::get_file_space(slice).getId(), arena_props.getId(),
+                           static_cast<void*>(strings.data())) < 0) {
+            HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Read: ");
+        }
+    } catch (const DataSetException&) {
+        column.clear();
+        throw;
+    }
+    arena.collect(strings, column);
+}
+
+
 template <typename Derivate>
 template <typename T>
-inline void SliceTraits<Derivate>::write(const T& buffer) {
+inline void SliceTraits<Derivate>::write(const T& buffer, const DataTransferProps& xfer_props) {
     const auto& slice = static_cast<const Derivate&>(*this);
-    const DataSpace& mem_space = slice.getMemSpace();
-    const details::BufferInfo<T> buffer_info(slice.getDataType());
+    const DataSpace& mem_space = details::get_mem_space(slice);
+    const details::BufferInfo<T> buffer_info(details::get_file_datatype(slice));
 
     if (!details::checkDimensions(mem_space, buffer_info.n_dimensions)) {
         std::ostringstream ss;
@@ -208,28 +1325,94 @@ inline void SliceTraits<Derivate>::write(const T& buffer) {
            << " into dataset of dimensions " << mem_space.getNumberDimensions();
         throw DataSpaceException(ss.str());
     }
+    if (details::get_column_order(slice).empty() &&
+        details::write_rows(slice, buffer, mem_space, buffer_info.data_type,
+                            xfer_props.getId())) {
+        details::record_chunk_access(slice);
+        return;
+    }
     details::data_converter<T> converter(mem_space);
-    write_raw(converter.transform_write(buffer), buffer_info.data_type);
+    write_raw(converter.transform_write(buffer), buffer_info.data_type, xfer_props);
 }
 
 
 template <typename Derivate>
 template <typename T>
-inline void SliceTraits<Derivate>::write_raw(const T* buffer, const DataType& dtype) {
+inline void SliceTraits<Derivate>::write_raw(const T* buffer,
+                                             const DataType& dtype,
+                                             const DataTransferProps& xfer_props) {
     using element_type = typename details::type_of_array<T>::type;
     const auto& slice = static_cast<const Derivate&>(*this);
     const auto& mem_datatype =
-        dtype.empty() ? create_and_check_datatype<element_type>() : dtype;
+        dtype.empty() ? details::cached_checked_datatype<element_type>() : dtype;
 
+    details::record_chunk_access(slice);
+    if (!details::get_column_order(slice).empty()) {
+        details::write_in_column_order(slice, static_cast<const void*>(buffer), mem_datatype,
+                                       xfer_props.getId());
+        return;
+    }
     if (H5Dwrite(details::get_dataset(slice).getId(),
                  mem_datatype.getId(),
                  details::get_memspace_id(slice),
-                 slice.getSpace().getId(), H5P_DEFAULT,
+                 details::get_file_space(slice).getId(), xfer_props.getId(),
                  static_cast<const void*>(buffer)) < 0) {
         HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Write: ");
     }
 }
 
+
+template <typename Derivate>
+template <typename T, std::size_t N>
+inline void SliceTraits<Derivate>::write(ArrayView<T, N> view,
+                                          const DataType& dtype,
+                                          const DataTransferProps& xfer_props) {
+    using element_type = typename std::remove_const<T>::type;
+    const auto& slice = static_cast<const Derivate&>(*this);
+    const DataSpace file_space = details::get_file_space(slice);
+    details::check_view_size(view.getElementCount(), slice);
+    const DataType& mem_datatype =
+        dtype.empty() ? details::cached_checked_datatype<element_type>() : dtype;
+
+    details::record_chunk_access(slice);
+    if (!details::get_column_order(slice).empty()) {
+        std::vector<char, DefaultInitAllocator<char>> buffer(view.getElementCount() *
+                                                             mem_datatype.getSize());
+        if (H5Dgather(view.getMemSpace().getId(), static_cast<const void*>(view.data()),
+                      mem_datatype.getId(), buffer.size(), buffer.data(), NULL, NULL) < 0) {
+            HDF5ErrMapper::ToException<DataSpaceException>("Unable to gather from the view");
+        }
+        details::write_in_column_order(slice, buffer.data(), mem_datatype, xfer_props.getId());
+        return;
+    }
+    if (H5Dwrite(details::get_dataset(slice).getId(),
+                 mem_datatype.getId(),
+                 view.getMemSpace().getId(),
+                 file_space.getId(), xfer_props.getId(),
+                 static_cast<const void*>(view.data())) < 0) {
+        HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Write: ");
+    }
+}
+
+
+template <typename Derivate>
+inline void SliceTraits<Derivate>::write(const StringColumn& column,
+                                          const DataTransferProps& xfer_props) {
+    const auto& slice = static_cast<const Derivate&>(*this);
+    const size_t n_strings = details::get_mem_space(slice).getElementCount();
+    if (column.size() != n_strings) {
+        std::ostringstream ss;
+        ss << "Impossible to write StringColumn of " << column.size()
+           << " strings into a selection of " << n_strings << " elements";
+        throw DataSpaceException(ss.str());
+    }
+    std::vector<const char*> strings(n_strings);
+    for (size_t i = 0; i < n_strings; ++i) {
+        strings[i] = column[i];
+    }
+    write_raw(strings.data(), details::cached_datatype<std::string>(), xfer_props);
+}
+
 }  // namespace HighFive
 
 #endif  // H5SLICE_TRAITS_MISC_HPP
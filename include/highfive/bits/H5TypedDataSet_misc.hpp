@@ -0,0 +1,198 @@
+/*
+ *  Copyright (c), 2020, Blue Brain Project - EPFL
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#ifndef H5TYPEDDATASET_MISC_HPP
+#define H5TYPEDDATASET_MISC_HPP
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include <H5Dpublic.h>
+#include <H5Ipublic.h>
+#include <H5Spublic.h>
+#include <H5Tpublic.h>
+
+namespace HighFive {
+
+// class TypedDataSet<T, N>
+
+template <typename T, std::size_t N>
+inline TypedDataSet<T, N>::TypedDataSet(const DataSet& dataset)
+    : _dataset(dataset)
+    , _dims()
+    , _file_space(dataset.getSpace()) {
+    const std::vector<size_t> dims = dataset.getDimensions();
+    if (dims.size() != N) {
+        std::ostringstream ss;
+        ss << "Impossible to access DataSet of dimensions " << dims.size()
+           << " with a TypedDataSet of dimensions " << N;
+        throw DataSetException(ss.str());
+    }
+    std::copy(dims.begin(), dims.end(), _dims.begin());
+
+    const DataType& mem_datatype = details::cached_checked_datatype<T>();
+    const DataType file_datatype = dataset.getDataType();
+    const hid_t file_type_id = file_datatype.getId();
+    if (file_datatype.getClass() != mem_datatype.getClass() ||
+        file_datatype.getSize() != mem_datatype.getSize() ||
+        (file_datatype.getClass() == DataTypeClass::Integer &&
+         H5Tget_sign(file_type_id) != H5Tget_sign(mem_datatype.getId()))) {
+        throw DataTypeException("Impossible to access DataSet of type " +
+                                file_datatype.string() + " as " +
+                                mem_datatype.string());
+    }
+}
+
+template <typename T, std::size_t N>
+inline std::size_t TypedDataSet<T, N>::getElementCount() const noexcept {
+    return std::accumulate(_dims.begin(), _dims.end(), std::size_t{1},
+                           std::multiplies<std::size_t>());
+}
+
+template <typename T, std::size_t N>
+inline std::pair<DataSpace, DataSpace> TypedDataSet<T, N>::selectBlock(
+    const extent_type& offset, const extent_type& count) const {
+    std::array<hsize_t, N> start, extent;
+    for (std::size_t i = 0; i < N; ++i) {
+        if (count[i] > _dims[i] || offset[i] > _dims[i] - count[i]) {
+            throw DataSpaceException("Block selection out of the DataSet bounds");
+        }
+        start[i] = offset[i];
+        extent[i] = count[i];
+    }
+    DataSpace file_space = _file_space.clone();
+    if (H5Sselect_hyperslab(file_space.getId(), H5S_SELECT_SET, start.data(),
+                            nullptr, extent.data(), nullptr) < 0) {
+        HDF5ErrMapper::ToException<DataSpaceException>("Unable to select hyperslap");
+    }
+    return {std::move(file_space), DataSpace(count.begin(), count.end())};
+}
+
+template <typename T, std::size_t N>
+inline void TypedDataSet<T, N>::read(T* buffer) const {
+    if (H5Dread(_dataset.getId(), details::cached_checked_datatype<T>().getId(),
+                H5S_ALL, H5S_ALL, H5P_DEFAULT, static_cast<void*>(buffer)) < 0) {
+        HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Read: ");
+    }
+}
+
+template <typename T, std::size_t N>
+inline void TypedDataSet<T, N>::read(const extent_type& offset,
+                                     const extent_type& count,
+                                     T* buffer) const {
+    const auto spaces = selectBlock(offset, count);
+    if (H5Dread(_dataset.getId(), details::cached_checked_datatype<T>().getId(),
+                spaces.second.getId(), spaces.first.getId(), H5P_DEFAULT,
+                static_cast<void*>(buffer)) < 0) {
+        HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Read: ");
+    }
+}
+
+template <typename T, std::size_t N>
+inline void TypedDataSet<T, N>::write(const T* buffer) {
+    if (H5Dwrite(_dataset.getId(), details::cached_checked_datatype<T>().getId(),
+                 H5S_ALL, H5S_ALL, H5P_DEFAULT, static_cast<const void*>(buffer)) < 0) {
+        HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Write: ");
+    }
+}
+
+template <typename T, std::size_t N>
+inline void TypedDataSet<T, N>::write(const extent_type& offset,
+                                      const extent_type& count,
+                                      const T* buffer) {
+    const auto spaces = selectBlock(offset, count);
+    if (H5Dwrite(_dataset.getId(), details::cached_checked_datatype<T>().getId(),
+                 spaces.second.getId(), spaces.first.getId(), H5P_DEFAULT,
+                 static_cast<const void*>(buffer)) < 0) {
+        HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Write: ");
+    }
+}
+
+template <typename T, std::size_t N>
+inline TypedSelection<T, N> TypedDataSet<T, N>::select(const extent_type& offset,
+                                                       const extent_type& count) const {
+    return TypedSelection<T, N>(_dataset, selectBlock(offset, count).first, _dims, offset,
+                                count);
+}
+
+template <typename T, std::size_t N>
+inline void TypedDataSet<T, N>::resize(const extent_type& dims) {
+    _dataset.resize(std::vector<size_t>(dims.begin(), dims.end()));
+    _dims = dims;
+    _file_space = _dataset.getSpace();
+}
+
+
+// class TypedSelection<T, N>
+
+template <typename T, std::size_t N>
+inline TypedSelection<T, N>::TypedSelection(const DataSet& dataset,
+                                            const DataSpace& file_space,
+                                            const extent_type& dataset_dims,
+                                            const extent_type& offset,
+                                            const extent_type& count)
+    : _dataset(dataset)
+    , _file_space(file_space)
+    , _mem_space(count.begin(), count.end())
+    , _dataset_dims(dataset_dims)
+    , _offset(offset)
+    , _dims(count) {}
+
+template <typename T, std::size_t N>
+inline std::size_t TypedSelection<T, N>::getElementCount() const noexcept {
+    return std::accumulate(_dims.begin(), _dims.end(), std::size_t{1},
+                           std::multiplies<std::size_t>());
+}
+
+template <typename T, std::size_t N>
+inline TypedSelection<T, N>& TypedSelection<T, N>::setOffset(const extent_type& offset) {
+    std::array<hsize_t, N> start, extent;
+    for (std::size_t i = 0; i < N; ++i) {
+        if (offset[i] > _dataset_dims[i] - _dims[i]) {
+            throw DataSpaceException("Block selection out of the DataSet bounds");
+        }
+        start[i] = offset[i];
+        extent[i] = _dims[i];
+    }
+    // Copies share the dataspace until moved
+    if (H5Iget_ref(_file_space.getId()) > 1) {
+        _file_space = _file_space.clone();
+    }
+    if (H5Sselect_hyperslab(_file_space.getId(), H5S_SELECT_SET, start.data(),
+                            nullptr, extent.data(), nullptr) < 0) {
+        HDF5ErrMapper::ToException<DataSpaceException>("Unable to select hyperslap");
+    }
+    _offset = offset;
+    return *this;
+}
+
+template <typename T, std::size_t N>
+inline void TypedSelection<T, N>::read(T* buffer) const {
+    if (H5Dread(_dataset.getId(), details::cached_checked_datatype<T>().getId(),
+                _mem_space.getId(), _file_space.getId(), H5P_DEFAULT,
+                static_cast<void*>(buffer)) < 0) {
+        HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Read: ");
+    }
+}
+
+template <typename T, std::size_t N>
+inline void TypedSelection<T, N>::write(const T* buffer) {
+    if (H5Dwrite(_dataset.getId(), details::cached_checked_datatype<T>().getId(),
+                 _mem_space.getId(), _file_space.getId(), H5P_DEFAULT,
+                 static_cast<const void*>(buffer)) < 0) {
+        HDF5ErrMapper::ToException<DataSetException>("Error during HDF5 Write: ");
+    }
+}
+
+}  // namespace HighFive
+
+#endif  // H5TYPEDDATASET_MISC_HPP
@@ -50,8 +50,8 @@ struct array_dims<FixedLenStringArray<N>> {
     static constexpr size_t value = 1;
 };
 
-template <typename T>
-struct array_dims<std::vector<T> > {
+template <typename T, typename Allocator>
+struct array_dims<std::vector<T, Allocator> > {
     static constexpr size_t value = 1 + array_dims<T>::value;
 };
 
@@ -99,14 +99,14 @@ struct array_dims<std::vector<Eigen::Matrix<T, M, N>>> {
 template <typename T>
 inline void get_dim_vector_rec(const T& /*vec*/, std::vector<size_t>& /*dims*/) {}
 
-template <typename T>
-inline void get_dim_vector_rec(const std::vector<T>& vec, std::vector<size_t>& dims) {
+template <typename T, typename Allocator>
+inline void get_dim_vector_rec(const std::vector<T, Allocator>& vec, std::vector<size_t>& dims) {
     dims.push_back(vec.size());
     get_dim_vector_rec(vec[0], dims);
 }
 
-template <typename T>
-inline std::vector<size_t> get_dim_vector(const std::vector<T>& vec) {
+template <typename T, typename Allocator>
+inline std::vector<size_t> get_dim_vector(const std::vector<T, Allocator>& vec) {
     std::vector<size_t> dims;
     get_dim_vector_rec(vec, dims);
     return dims;
@@ -137,8 +137,8 @@ struct type_of_array {
     typedef unqualified_t<T> type;
 };
 
-template <typename T>
-struct type_of_array<std::vector<T>> {
+template <typename T, typename Allocator>
+struct type_of_array<std::vector<T, Allocator>> {
     typedef typename type_of_array<T>::type type;
 };
 
@@ -208,8 +208,8 @@ struct is_container {
     static const bool value = false;
 };
 
-template <typename T>
-struct is_container<std::vector<T> > {
+template <typename T, typename Allocator>
+struct is_container<std::vector<T, Allocator> > {
     static const bool value = true;
 };
 
@@ -9,6 +9,9 @@
 #define H5_DEPRECATED
 #endif
 
+#include <cstddef>
+#include <vector>
+
 
 // Forward declarations
 
@@ -31,6 +34,13 @@ class ObjectInfo;
 class Reference;
 class Selection;
 class SilenceHDF5;
+class StringColumn;
+
+template <typename T, std::size_t N>
+class ArrayView;
+
+template <typename T>
+class ChunkRange;
 
 template <typename T>
 class AtomicType;
@@ -56,6 +66,22 @@ namespace details {
 template <typename T, typename Enable = void>
 struct data_converter;
 
+// Cached dataspace and datatype of a dataset, for the read/write paths. They
+// are shared by all the copies of the handle and must not be modified.
+DataSpace get_file_space(const DataSet& ds);
+DataType get_file_datatype(const DataSet& ds);
+
+// Dimensions of the chunks of a dataset, empty if it isn't chunked
+std::vector<std::size_t> get_chunk_dims(const DataSet& dataset);
+
+class ChunkCacheModel;
+
+// Counts the chunk cache accesses of a read or write, if enabled
+void record_chunk_access(const DataSet& ds, const DataSpace& file_space);
+
+// Order of the columns of a selection, relative to the file
+const std::vector<std::size_t>& get_column_order(const Selection& sel);
+
 }
 
 }  // namespace HighFive
@@ -81,12 +81,13 @@ inline DataSet initDataset(File& file,
 {
     if (!file.exist(path)) {
         detail::createGroupsToDataSet(file, path);
-        if (!options.compress() && !options.isChunked()) {
+        if (!options.compress() && !options.isChunked() && !options.isAutoChunked()) {
             return file.createDataSet<T>(path, DataSpace(shape));
         } else {
+            DataSpace space(shape);
             std::vector<hsize_t> chunks(shape.begin(), shape.end());
-            if (options.isChunked()) {
-                chunks = options.getChunkSize();
+            if (options.isChunked() || options.isAutoChunked()) {
+                chunks = options.getChunkSize(space, AtomicType<T>());
                 if (chunks.size() != shape.size()) {
                     throw error(file, path, "H5Easy::dump: Incorrect rank ChunkSize");
                 }
@@ -97,7 +98,7 @@ inline DataSet initDataset(File& file,
                 props.add(Shuffle());
                 props.add(Deflate(options.getCompressionLevel()));
             }
-            return file.createDataSet<T>(path, DataSpace(shape), props);
+            return file.createDataSet<T>(path, space, props);
         }
     } else if (options.overwrite() && file.getObjectType(path) == ObjectType::Dataset) {
         DataSet dataset = file.getDataSet(path);
@@ -47,6 +47,12 @@ inline void DumpOptions::set(const Compression& level)
     m_compression_level = level.get();
 }
 
+inline void DumpOptions::set(const AutoChunking& policy)
+{
+    m_auto_chunked = true;
+    m_auto_chunking = policy;
+}
+
 template <class T, class... Args>
 inline void DumpOptions::set(T arg, Args... args)
 {
@@ -95,6 +101,20 @@ inline std::vector<hsize_t> DumpOptions::getChunkSize() const
     return m_chunk_size;
 }
 
+inline bool DumpOptions::isAutoChunked() const
+{
+    return m_auto_chunked;
+}
+
+inline std::vector<hsize_t> DumpOptions::getChunkSize(const DataSpace& space,
+                                                      const DataType& type) const
+{
+    if (isChunked() || !isAutoChunked()) {
+        return m_chunk_size;
+    }
+    return Chunking(space, type, m_auto_chunking).getDimensions();
+}
+
 inline size_t getSize(const File& file, const std::string& path) {
     return file.getDataSet(path).getElementCount();
 }
@@ -97,17 +97,17 @@ struct io_impl {
         std::vector<size_t> shape = idx;
         const size_t unlim = DataSpace::UNLIMITED;
         std::vector<size_t> unlim_shape(idx.size(), unlim);
+        for (size_t& i : shape) {
+            i++;
+        }
+        DataSpace dataspace = DataSpace(shape, unlim_shape);
         std::vector<hsize_t> chunks(idx.size(), 10);
-        if (options.isChunked()) {
-            chunks = options.getChunkSize();
+        if (options.isChunked() || options.isAutoChunked()) {
+            chunks = options.getChunkSize(dataspace, AtomicType<T>());
             if (chunks.size() != idx.size()) {
                 throw error(file, path, "H5Easy::dump: Incorrect dimension ChunkSize");
             }
         }
-        for (size_t& i : shape) {
-            i++;
-        }
-        DataSpace dataspace = DataSpace(shape, unlim_shape);
         DataSetCreateProps props;
         props.add(Chunking(chunks));
         DataSet dataset = file.createDataSet(path, dataspace, AtomicType<T>(), props);
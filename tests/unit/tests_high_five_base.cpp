@@ -8,18 +8,23 @@
  */
 
 #include <algorithm>
+#include <cmath>
 #include <cstdio>
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
 #include <memory>
+#include <numeric>
 #include <random>
+#include <sstream>
 #include <string>
 #include <typeinfo>
 #include <vector>
 
 #include <highfive/H5DataSet.hpp>
+#include <highfive/H5DataSetAppender.hpp>
 #include <highfive/H5DataSpace.hpp>
+#include <highfive/H5DirectChunk.hpp>
 #include <highfive/H5File.hpp>
 #include <highfive/H5Group.hpp>
 #include <highfive/H5Reference.hpp>
@@ -138,6 +143,61 @@ BOOST_AUTO_TEST_CASE(HighFiveOpenMode) {
     { File file(FILE_NAME, 0); }  // force empty-flags, does open without flags
 }
 
+BOOST_AUTO_TEST_CASE(HighFiveCoreDriverAndImages) {
+    const std::string FILE_NAME("core_driver.h5");
+    const std::vector<int> values{1, 2, 3, 5, 8};
+    std::remove(FILE_NAME.c_str());
+
+    // Without backing store, nothing reaches the disk
+    std::vector<char> image;
+    {
+        File file(FILE_NAME, File::ReadWrite | File::Create, CoreFileDriver());
+        file.createDataSet("dset", values);
+        image = file.toImage();
+    }
+    std::FILE* on_disk = std::fopen(FILE_NAME.c_str(), "r");
+    BOOST_CHECK(on_disk == nullptr);
+    if (on_disk != nullptr) {
+        std::fclose(on_disk);
+    }
+    BOOST_CHECK(!image.empty());
+
+    {
+        File file = File::fromImage(image);
+        File other = File::fromImage(image.data(), image.size());
+        std::vector<int> result;
+        file.getDataSet("dset").read(result);
+        BOOST_CHECK(result == values);
+        other.getDataSet("dset").read(result);
+        BOOST_CHECK(result == values);
+
+        SilenceHDF5 silencer;
+        BOOST_CHECK_THROW(file.createGroup("group"), GroupException);
+    }
+
+    // Modified in memory
+    {
+        File file = File::fromImage(image, File::ReadWrite);
+        file.getDataSet("dset").write(std::vector<int>(values.size(), 0));
+        std::vector<int> result;
+        File::fromImage(file.toImage()).getDataSet("dset").read(result);
+        BOOST_CHECK(result == std::vector<int>(values.size(), 0));
+    }
+
+    // With backing store, the file is written when closed
+    {
+        File file(FILE_NAME, File::ReadWrite | File::Create, CoreFileDriver(4096, true));
+        file.createDataSet("dset", values);
+    }
+    {
+        File file(FILE_NAME);
+        std::vector<int> result;
+        file.getDataSet("dset").read(result);
+        BOOST_CHECK(result == values);
+        BOOST_CHECK_EQUAL(file.toImage().size(), image.size());
+    }
+}
+
 BOOST_AUTO_TEST_CASE(HighFiveGroupAndDataSet) {
     const std::string FILE_NAME("h5_group_test.h5");
     const std::string DATASET_NAME("dset");
@@ -253,11 +313,28 @@ BOOST_AUTO_TEST_CASE(HighFiveExtensibleDataSet) {
         // Write into the initial part of the dataset
         dataset.select({0, 0}, {3, 1}).write(t1);
 
+        // Copies of the handle share the cached dimensions
+        const DataSet dataset_copy = dataset;
+        BOOST_CHECK_EQUAL(20, dataset_copy.getElementCount());
+        BOOST_CHECK_EQUAL(17, dataset_copy.getMaxDimensions()[0]);
+        const Selection first_rows = dataset_copy.select({0, 0}, {3, 1});
+
+        // The datatype returned is a copy
+        DataType modified_type = dataset.getDataType();
+        H5Tset_order(modified_type.getId(), H5T_ORDER_BE);
+        BOOST_CHECK(dataset_copy.getDataType() == AtomicType<double>());
+
         // Resize the dataset to a larger size
         dataset.resize({4, 6});
 
         BOOST_CHECK_EQUAL(4, dataset.getSpace().getDimensions()[0]);
         BOOST_CHECK_EQUAL(6, dataset.getSpace().getDimensions()[1]);
+        BOOST_CHECK(dataset_copy.getDimensions() == dataset.getSpace().getDimensions());
+        BOOST_CHECK_EQUAL(24, dataset_copy.getElementCount());
+        // Selections made before keep their dataspace
+        std::vector<double> first_values;
+        first_rows.read(first_values);
+        BOOST_CHECK_EQUAL(first_values.size(), 3);
 
         // Write into the new part of the dataset
         dataset.select({3, 3}, {1, 3}).write(t2);
@@ -290,6 +367,433 @@ BOOST_AUTO_TEST_CASE(HighFiveExtensibleDataSet) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(HighFiveDataSetAppender) {
+    const std::string FILE_NAME("dataset_appender.h5");
+    File file(FILE_NAME, File::ReadWrite | File::Create | File::Truncate);
+
+    DataSetCreateProps props;
+    props.add(Chunking(std::vector<hsize_t>{4, 3}));
+    DataSet dataset = file.createDataSet<int>(
+        "rows", DataSpace({2, 3}, {DataSpace::UNLIMITED, 3}), props);
+    const int first_rows[2][3] = {{0, 1, 2}, {3, 4, 5}};
+    dataset.write(first_rows);
+
+    {
+        DataSetAppender<int> appender(dataset, 8);
+        BOOST_CHECK_EQUAL(appender.getRowSize(), 3);
+        BOOST_CHECK_EQUAL(appender.size(), 2);
+        // Rows of several elements can't be appended as single values
+        BOOST_CHECK_THROW(appender.append(3), DataSpaceException);
+        BOOST_CHECK_EQUAL(appender.size(), 2);
+
+        for (int i = 2; i < 30; ++i) {
+            const int row[3] = {3 * i, 3 * i + 1, 3 * i + 2};
+            appender.append(row);
+        }
+        std::vector<int> more_rows(3 * 20);
+        std::iota(more_rows.begin(), more_rows.end(), 90);
+        appender.append(more_rows.data(), 20);
+        BOOST_CHECK_EQUAL(appender.size(), 50);
+        // Grown by whole blocks, ahead of the appended rows
+        BOOST_CHECK(dataset.getDimensions()[0] >= 48);
+        BOOST_CHECK_EQUAL(dataset.getDimensions()[0] % 8, 0);
+
+        appender.flush();
+        BOOST_CHECK_EQUAL(dataset.getDimensions()[0], 50);
+
+        // Appending after a flush, flushed on destruction
+        const int last_row[3] = {150, 151, 152};
+        appender.append(last_row);
+    }
+
+    std::vector<std::vector<int>> result;
+    file.getDataSet("rows").read(result);
+    BOOST_CHECK_EQUAL(result.size(), 51);
+    for (size_t i = 0; i < result.size(); ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            BOOST_CHECK_EQUAL(result[i][j], static_cast<int>(3 * i + j));
+        }
+    }
+
+    // 1D dataset, appending values
+    DataSetCreateProps props_1d;
+    props_1d.add(Chunking(std::vector<hsize_t>{16}));
+    DataSet values = file.createDataSet<double>(
+        "values", DataSpace({0}, {DataSpace::UNLIMITED}), props_1d);
+    {
+        DataSetAppender<double> appender(values);
+        for (int i = 0; i < 1000; ++i) {
+            appender.append(0.5 * i);
+        }
+    }
+    std::vector<double> values_back;
+    values.read(values_back);
+    BOOST_CHECK_EQUAL(values_back.size(), 1000);
+    BOOST_CHECK_EQUAL(values_back[999], 499.5);
+
+    // Contiguous datasets can't be extended
+    DataSet contiguous = file.createDataSet<int>("contiguous", DataSpace({4}));
+    BOOST_CHECK_THROW(DataSetAppender<int>{contiguous}, DataSetException);
+}
+
+void checkChunkRange(const DataSet& dataset, const std::vector<std::vector<int>>& values,
+                     size_t n_blocks, bool prefetch) {
+    auto range = dataset.chunks<int>(prefetch);
+    BOOST_CHECK_EQUAL(range.size(), n_blocks);
+    std::vector<std::vector<int>> seen(values.size(), std::vector<int>(values[0].size(), 0));
+    size_t n_seen = 0;
+    for (const auto& block : range) {
+        BOOST_CHECK_EQUAL(block.data.size(), block.count[0] * block.count[1]);
+        for (size_t i = 0; i < block.count[0]; ++i) {
+            for (size_t j = 0; j < block.count[1]; ++j) {
+                const size_t row = block.offset[0] + i, col = block.offset[1] + j;
+                BOOST_CHECK_EQUAL(block.data[i * block.count[1] + j], values[row][col]);
+                ++seen[row][col];
+            }
+        }
+        ++n_seen;
+    }
+    BOOST_CHECK_EQUAL(n_seen, n_blocks);
+    for (const auto& row : seen) {
+        BOOST_CHECK(std::all_of(row.begin(), row.end(), [](int n) { return n == 1; }));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(HighFiveChunkRange) {
+    const std::string FILE_NAME("chunk_range.h5");
+    File file(FILE_NAME, File::ReadWrite | File::Create | File::Truncate);
+
+    std::vector<std::vector<int>> values(10, std::vector<int>(7));
+    for (size_t i = 0; i < 10; ++i) {
+        for (size_t j = 0; j < 7; ++j) {
+            values[i][j] = static_cast<int>(10 * i + j);
+        }
+    }
+
+    DataSetCreateProps props;
+    props.add(Chunking(std::vector<hsize_t>{4, 3}));
+    DataSet chunked = file.createDataSet<int>("chunked", DataSpace::From(values), props);
+    chunked.write(values);
+    BOOST_CHECK(chunked.chunks<int>().getBlockDimensions() == (std::vector<size_t>{4, 3}));
+    checkChunkRange(chunked, values, 9, true);
+    checkChunkRange(chunked, values, 9, false);
+
+    // A range can be iterated again
+    auto range = chunked.chunks<int>();
+    BOOST_CHECK_EQUAL(std::distance(range.begin(), range.end()), 9);
+    BOOST_CHECK_EQUAL(range.begin()->data[0], 0);
+
+    // Chunks written last to first are visited in file order
+    DataSet reversed = file.createDataSet<int>("reversed", DataSpace::From(values), props);
+    for (size_t i = 3; i-- > 0;) {
+        for (size_t j = 3; j-- > 0;) {
+            const std::vector<size_t> offset{4 * i, 3 * j};
+            const std::vector<size_t> count{std::min(size_t{4}, 10 - offset[0]),
+                                            std::min(size_t{3}, 7 - offset[1])};
+            std::vector<int> block;
+            for (size_t k = 0; k < count[0]; ++k) {
+                for (size_t l = 0; l < count[1]; ++l) {
+                    block.push_back(values[offset[0] + k][offset[1] + l]);
+                }
+            }
+            reversed.select(offset, count).write_raw(block.data());
+            file.flush();  // allocates the chunk
+        }
+    }
+    checkChunkRange(reversed, values, 9, true);
+#if H5_VERSION_GE(1, 10, 5)
+    auto reversed_range = reversed.chunks<int>();
+    BOOST_CHECK(reversed_range.begin()->offset == (std::vector<size_t>{8, 6}));
+#endif
+
+    // Datasets without chunks are read by blocks of whole rows
+    DataSet contiguous = file.createDataSet("contiguous", values);
+    checkChunkRange(contiguous, values, 1, true);
+}
+
+BOOST_AUTO_TEST_CASE(HighFiveReadRanges) {
+    const std::string FILE_NAME("h5_read_ranges_test.h5");
+    const size_t n_rows = 50;
+    const size_t n_columns = 3;
+    std::vector<int> values(n_rows * n_columns);
+    std::iota(values.begin(), values.end(), 0);
+
+    File file(FILE_NAME, File::ReadWrite | File::Create | File::Truncate);
+    DataSet dataset = file.createDataSet<int>("dset", DataSpace({n_rows, n_columns}));
+    dataset.write_raw(values.data());
+
+    auto check = [&](const std::vector<std::pair<size_t, size_t>>& ranges) {
+        std::vector<int> result;
+        const std::vector<size_t> offsets = dataset.readRanges(ranges, result);
+        BOOST_REQUIRE_EQUAL(offsets.size(), ranges.size() + 1);
+        BOOST_REQUIRE_EQUAL(result.size(), offsets.back() * n_columns);
+        for (size_t i = 0; i < ranges.size(); ++i) {
+            BOOST_CHECK_EQUAL(offsets[i + 1] - offsets[i], ranges[i].second - ranges[i].first);
+            for (size_t row = ranges[i].first; row < ranges[i].second; ++row) {
+                for (size_t j = 0; j < n_columns; ++j) {
+                    BOOST_CHECK_EQUAL(result[(offsets[i] + row - ranges[i].first) * n_columns + j],
+                                      values[row * n_columns + j]);
+                }
+            }
+        }
+    };
+
+    // In order, adjacent and empty ranges
+    check({{0, 2}, {5, 9}, {9, 10}, {12, 12}, {30, 50}});
+    // Out of order and overlapping
+    check({{40, 45}, {3, 8}, {6, 12}, {0, 1}, {42, 43}});
+    check({});
+    std::vector<std::pair<size_t, size_t>> many;
+    for (size_t i = 0; i < 24; ++i) {
+        many.emplace_back(2 * i, 2 * i + 1);
+    }
+    check(many);
+
+    std::vector<int> result;
+    BOOST_CHECK_THROW(dataset.readRanges({{45, 51}}, result), DataSpaceException);
+    BOOST_CHECK_THROW(dataset.readRanges({{5, 4}}, result), DataSpaceException);
+}
+
+BOOST_AUTO_TEST_CASE(HighFiveDataTransferProps) {
+    const std::string FILE_NAME("h5_transfer_props_test.h5");
+    const size_t n_values = 1000;
+    std::vector<int> values(n_values);
+    std::iota(values.begin(), values.end(), 0);
+
+    File file(FILE_NAME, File::ReadWrite | File::Create | File::Truncate);
+    DataSet dataset = file.createDataSet<int>("dset", DataSpace({n_values}));
+
+    DataTransferProps scale;
+    scale.add(DataTransform("2*x"));
+    dataset.write(values, scale);
+
+    // Converted read, with a conversion buffer smaller than the data
+    DataTransferProps buffer_props;
+    buffer_props.add(ConversionBuffer(256));
+    buffer_props.add(HyperVectorSize(8));
+    std::vector<double> converted;
+    dataset.read(converted, buffer_props);
+    BOOST_REQUIRE_EQUAL(converted.size(), n_values);
+    for (size_t i = 0; i < n_values; ++i) {
+        BOOST_CHECK_EQUAL(converted[i], 2. * values[i]);
+    }
+
+    DataTransferProps shift;
+    shift.add(DataTransform("x-1"));
+    std::vector<double> shifted;
+    dataset.read(shifted, shift);
+    std::vector<int> points;
+    dataset.select(ElementSet(std::vector<size_t>{1, 5, 7})).read(points, shift);
+    for (size_t i = 0; i < n_values; ++i) {
+        BOOST_CHECK_EQUAL(shifted[i], 2. * values[i] - 1.);
+    }
+    BOOST_CHECK_EQUAL(points[0], 1);
+    BOOST_CHECK_EQUAL(points[2], 13);
+
+    std::vector<int> result;
+    const std::vector<size_t> offsets = dataset.readRanges({{10, 12}, {3, 4}}, result, shift);
+    BOOST_REQUIRE_EQUAL(offsets.back(), 3);
+    BOOST_CHECK_EQUAL(result[0], 19);
+    BOOST_CHECK_EQUAL(result[2], 5);
+
+    SilenceHDF5 silence;
+    DataTransferProps invalid;
+    BOOST_CHECK_THROW(invalid.add(DataTransform("2*")), PropertyException);
+}
+
+#if defined(H5_USE_ZLIB) && H5_VERSION_GE(1, 10, 3)
+BOOST_AUTO_TEST_CASE(HighFiveChunkWriter) {
+    const std::string FILE_NAME("chunk_writer.h5");
+    File file(FILE_NAME, File::ReadWrite | File::Create | File::Truncate);
+
+    const size_t rows = 37, cols = 11;
+    std::vector<int> values(rows * cols);
+    std::iota(values.begin(), values.end(), -100);
+
+    DataSetCreateProps props;
+    props.add(Chunking(std::vector<hsize_t>{8, 4}));
+    props.add(Shuffle());
+    props.add(Deflate(4));
+    DataSet dataset = file.createDataSet<int>("compressed", DataSpace({rows, cols}), props);
+
+    // Whole dataset, with edge chunks, on more threads than chunks per batch
+    ChunkWriter<int> writer(dataset, 3);
+    BOOST_CHECK_EQUAL(writer.getThreadCount(), 3);
+    writer.write(values.data());
+    std::vector<std::vector<int>> result;
+    dataset.read(result);
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < cols; ++j) {
+            BOOST_CHECK_EQUAL(result[i][j], values[i * cols + j]);
+        }
+    }
+    BOOST_CHECK_LT(dataset.getStorageSize(), rows * cols * sizeof(int));
+
+    // A block of whole chunks, ending at the edge
+    std::vector<int> block(8 * 7, 42);
+    writer.write({8, 4}, {8, 7}, block.data());
+    dataset.read(result);
+    BOOST_CHECK_EQUAL(result[8][4], 42);
+    BOOST_CHECK_EQUAL(result[15][10], 42);
+    BOOST_CHECK_EQUAL(result[15][3], values[15 * cols + 3]);
+    BOOST_CHECK_EQUAL(result[16][4], values[16 * cols + 4]);
+
+    BOOST_CHECK_THROW(writer.write({4, 0}, {8, 4}, block.data()), DataSpaceException);
+    BOOST_CHECK_THROW(writer.write({0, 0}, {8, 5}, block.data()), DataSpaceException);
+    BOOST_CHECK_THROW(ChunkWriter<float>{dataset}, DataTypeException);
+
+    // Deflate alone
+    DataSetCreateProps deflate_props;
+    deflate_props.add(Chunking(std::vector<hsize_t>{16}));
+    deflate_props.add(Deflate(9));
+    DataSet deflated = file.createDataSet<int>("deflated", DataSpace({rows * cols}),
+                                               deflate_props);
+    ChunkWriter<int>(deflated).write(values.data());
+    std::vector<int> flat;
+    deflated.read(flat);
+    BOOST_CHECK(flat == values);
+
+    // Edges of chunks outside of the dataset hold the fill value, seen once
+    // the dataset is extended
+    DataSetCreateProps grow_props;
+    grow_props.add(Chunking(std::vector<hsize_t>{4}));
+    grow_props.add(Deflate(1));
+    RawPropertyList<PropertyType::DATASET_CREATE> filled_props(grow_props);
+    const int fill_value = -7;
+    filled_props.add(H5Pset_fill_value, H5T_NATIVE_INT, &fill_value);
+    DataSet growing = file.createDataSet<int>(
+        "growing", DataSpace({6}, {DataSpace::UNLIMITED}), filled_props);
+    const int six[6] = {1, 2, 3, 4, 5, 6};
+    ChunkWriter<int>(growing).write(six);
+    growing.resize({8});
+    std::vector<int> grown;
+    growing.read(grown);
+    BOOST_CHECK_EQUAL(grown[5], 6);
+    BOOST_CHECK_EQUAL(grown[6], fill_value);
+    BOOST_CHECK_EQUAL(grown[7], fill_value);
+
+    DataSet contiguous = file.createDataSet<int>("contiguous", DataSpace({4}));
+    BOOST_CHECK_THROW(ChunkWriter<int>{contiguous}, DataSetException);
+}
+
+BOOST_AUTO_TEST_CASE(HighFiveChunkReader) {
+    const std::string FILE_NAME("chunk_reader.h5");
+    File file(FILE_NAME, File::ReadWrite | File::Create | File::Truncate);
+
+    const size_t rows = 29, cols = 13;
+    std::vector<std::vector<double>> values(rows, std::vector<double>(cols));
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < cols; ++j) {
+            values[i][j] = static_cast<double>(i) + 0.01 * static_cast<double>(j);
+        }
+    }
+
+    DataSetCreateProps props;
+    props.add(Chunking(std::vector<hsize_t>{6, 5}));
+    props.add(Shuffle());
+    props.add(Deflate(6));
+    DataSet dataset = file.createDataSet<double>("compressed", DataSpace({rows, cols}), props);
+    // The last rows of chunks are never written
+    std::vector<std::vector<double>> head(values.begin(), values.begin() + 24);
+    dataset.select({0, 0}, {24, cols}).write(head);
+
+    ChunkReader<double> reader(dataset, 3);
+    std::vector<double> result(rows * cols, -1.);
+    reader.read(result.data());
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < cols; ++j) {
+            BOOST_CHECK_EQUAL(result[i * cols + j], i < 24 ? values[i][j] : 0.);
+        }
+    }
+
+    // Blocks not aligned on chunks
+    std::vector<double> block(9 * 7);
+    reader.read({4, 3}, {9, 7}, block.data());
+    for (size_t i = 0; i < 9; ++i) {
+        for (size_t j = 0; j < 7; ++j) {
+            BOOST_CHECK_EQUAL(block[i * 7 + j], values[4 + i][3 + j]);
+        }
+    }
+    BOOST_CHECK_THROW(reader.read({25, 0}, {5, 1}, block.data()), DataSpaceException);
+    BOOST_CHECK_THROW(ChunkReader<int>{dataset}, DataTypeException);
+
+    // Chunks without filters
+    DataSetCreateProps chunk_props;
+    chunk_props.add(Chunking(std::vector<hsize_t>{4, 4}));
+    DataSet chunked = file.createDataSet("chunked", values, chunk_props);
+    ChunkReader<double>(chunked).read({1, 1}, {9, 7}, block.data());
+    BOOST_CHECK_EQUAL(block[0], values[1][1]);
+    BOOST_CHECK_EQUAL(block[9 * 7 - 1], values[9][7]);
+
+    // Partial edge chunks stored unfiltered
+    RawPropertyList<PropertyType::DATASET_CREATE> partial_props(props);
+    partial_props.add(H5Pset_chunk_opts, H5D_CHUNK_DONT_FILTER_PARTIAL_CHUNKS);
+    DataSet partial = file.createDataSet("partial", values, partial_props);
+    BOOST_CHECK_THROW(ChunkReader<double>{partial}, DataSetException);
+    BOOST_CHECK_THROW(ChunkWriter<double>{partial}, DataSetException);
+}
+#endif
+
+BOOST_AUTO_TEST_CASE(HighFiveChunkCache) {
+    // 1000 x 1000 doubles, by chunks of 100 x 10 (8000 bytes)
+    const std::vector<size_t> dims{1000, 1000}, chunk_dims{100, 10};
+    Caching rows(dims, chunk_dims, sizeof(double), CacheAccess::RowSweep);
+    BOOST_CHECK_EQUAL(rows.getCacheSize(), 100 * 8000);
+    BOOST_CHECK_EQUAL(rows.getSlotCount(), 10007);
+    BOOST_CHECK_EQUAL(rows.getW0(), 1.);
+    Caching columns(dims, chunk_dims, sizeof(double), CacheAccess::ColumnSweep);
+    BOOST_CHECK_EQUAL(columns.getCacheSize(), 10 * 8000);
+    BOOST_CHECK_EQUAL(columns.getSlotCount(), 1009);
+    Caching random(dims, chunk_dims, sizeof(double), CacheAccess::Random, 80000);
+    BOOST_CHECK_EQUAL(random.getCacheSize(), 10 * 8000);
+    // At least one chunk
+    Caching small(dims, chunk_dims, sizeof(double), CacheAccess::Random, 1000);
+    BOOST_CHECK_EQUAL(small.getCacheSize(), 8000);
+
+    const std::string FILE_NAME("chunk_cache.h5");
+    const std::string DATASET_NAME("dset");
+    File file(FILE_NAME, File::ReadWrite | File::Create | File::Truncate);
+    DataSetCreateProps props;
+    props.add(Chunking(std::vector<hsize_t>{10, 10}));
+    std::vector<std::vector<int>> values(100, std::vector<int>(100, 1));
+    DataSetAccessProps tuned;
+    {
+        // The cache is set when the dataset is first opened
+        DataSet dataset = file.createDataSet(DATASET_NAME, values, props);
+        BOOST_CHECK_EQUAL(dataset.getCacheStatistics().misses, 0);
+        Caching caching(dataset, CacheAccess::RowSweep);
+        BOOST_CHECK_EQUAL(caching.getCacheSize(), 10 * 400);
+        tuned.add(caching);
+    }
+
+    auto sweepRows = [&](const DataSetAccessProps& access) {
+        DataSet opened = file.getDataSet(DATASET_NAME, access);
+        opened.enableCacheStatistics();
+        std::vector<int> row;
+        for (size_t i = 0; i < 100; ++i) {
+            opened.select({i, 0}, {1, 100}).read(row);
+        }
+        return opened.getCacheStatistics();
+    };
+
+    // A cache holding a row of chunks reads each chunk once
+    ChunkCacheStatistics statistics = sweepRows(tuned);
+    BOOST_CHECK_EQUAL(statistics.misses, 100);
+    BOOST_CHECK_EQUAL(statistics.hits, 900);
+    BOOST_CHECK_CLOSE(statistics.getHitRate(), 0.9, 1e-6);
+
+    // A cache holding a single chunk thrashes
+    DataSetAccessProps thrashing;
+    thrashing.add(Caching(521, 400));
+    statistics = sweepRows(thrashing);
+    BOOST_CHECK_EQUAL(statistics.misses, 1000);
+    BOOST_CHECK_EQUAL(statistics.hits, 0);
+
+    DataSet contiguous = file.createDataSet<int>("contiguous", DataSpace({4}));
+    BOOST_CHECK_THROW(contiguous.enableCacheStatistics(), DataSetException);
+    BOOST_CHECK_THROW(Caching(contiguous, CacheAccess::Random), PropertyException);
+}
+
 BOOST_AUTO_TEST_CASE(HighFiveRefCountMove) {
     const std::string FILE_NAME("h5_ref_count_test.h5");
     const std::string DATASET_NAME("dset");
@@ -440,6 +944,22 @@ BOOST_AUTO_TEST_CASE(DataTypeEqualSimple) {
     BOOST_CHECK(int_var != uint_var);
 }
 
+BOOST_AUTO_TEST_CASE(DataTypeCached) {
+    // A single instance per type, equal to a freshly created one
+    const DataType& d_cached = details::cached_checked_datatype<double>();
+    BOOST_CHECK_EQUAL(d_cached.getId(), details::cached_checked_datatype<double>().getId());
+    BOOST_CHECK(d_cached == AtomicType<double>());
+
+    const DataType& str_cached = details::cached_datatype<std::string>();
+    BOOST_CHECK(str_cached.isVariableStr());
+    BOOST_CHECK(details::cached_datatype<char[7]>().isFixedLenStr());
+    BOOST_CHECK_EQUAL(details::cached_datatype<char[7]>().getSize(), 7);
+
+    // Unaffected by the lifetime of its copies
+    { const DataType copy = d_cached; }
+    BOOST_CHECK(d_cached.isValid());
+}
+
 BOOST_AUTO_TEST_CASE(DataTypeEqualTakeBack) {
     const std::string FILE_NAME("h5tutr_dset.h5");
     const std::string DATASET_NAME("dset");
@@ -581,6 +1101,42 @@ BOOST_AUTO_TEST_CASE(ChunkingConstructorsTest) {
                                   third_ans.end());
 }
 
+BOOST_AUTO_TEST_CASE(AutoChunkingTest) {
+    const size_t unlim = DataSpace::UNLIMITED;
+    const AutoChunking policy(64 * 1024);  // 16k floats
+
+    // Small datasets are a single chunk
+    std::vector<hsize_t> small{10, 7};
+    Chunking small_chunking(DataSpace({10, 7}), AtomicType<float>(), policy);
+    BOOST_CHECK(small_chunking.getDimensions() == small);
+
+    // Large ones are cut into chunks close to hypercubes, of at most the target size
+    DataSpace large({100000, 1000});
+    auto dims = Chunking(large, AtomicType<float>(), policy).getDimensions();
+    BOOST_CHECK_LE(dims[0] * dims[1] * sizeof(float), 64 * 1024);
+    BOOST_CHECK_GT(dims[0] * dims[1] * sizeof(float), 16 * 1024);
+    BOOST_CHECK_LE(std::max(dims[0], dims[1]), 2 * std::min(dims[0], dims[1]));
+
+    // Along an access axis
+    std::vector<hsize_t> columns{12500, 1};
+    BOOST_CHECK(policy.getDimensions({100000, 1000}, {}, sizeof(float)) == dims);
+    AutoChunking along_columns(64 * 1024, 0);
+    BOOST_CHECK(along_columns.getDimensions({100000, 1000}, {}, 4) == columns);
+    std::vector<hsize_t> rows{7, 1000};
+    AutoChunking along_rows = AutoChunking(64 * 1024).setAccessAxis(1);
+    BOOST_CHECK(along_rows.getDimensions({100000, 1000}, {}, sizeof(double)) == rows);
+
+    // Unlimited dimensions aren't bounded by their current extent
+    DataSpace growing({1, 3}, {unlim, 3});
+    std::vector<hsize_t> growing_ans{2048, 3};
+    Chunking growing_chunking(growing, AtomicType<double>(), policy);
+    BOOST_CHECK(growing_chunking.getDimensions() == growing_ans);
+
+    BOOST_CHECK_THROW(policy.getDimensions({}, {}, 4), DataSpaceException);
+    BOOST_CHECK_THROW(AutoChunking(1024, 2).getDimensions({4, 4}, {}, 4),
+                      DataSpaceException);
+}
+
 BOOST_AUTO_TEST_CASE(HighFiveReadWriteShortcut) {
     std::ostringstream filename;
     filename << "h5_rw_vec_shortcut_test.h5";
@@ -887,6 +1443,193 @@ BOOST_AUTO_TEST_CASE(selectionByElementMultiDim) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(selectionByElementGather) {
+    const std::string FILE_NAME("h5_test_selection_gather.h5");
+    const size_t x_size = 60;
+    const size_t y_size = 80;
+    std::vector<double> values(x_size * y_size);
+    std::iota(values.begin(), values.end(), 0.5);
+
+    File file(FILE_NAME, File::ReadWrite | File::Create | File::Truncate);
+    DataSetCreateProps props;
+    props.add(Chunking(std::vector<hsize_t>{10, 10}));
+    DataSet chunked = file.createDataSet<double>("chunked", DataSpace({x_size, y_size}), props);
+    DataSet contiguous = file.createDataSet<double>("contiguous", DataSpace({x_size, y_size}));
+    chunked.write_raw(values.data());
+    contiguous.write_raw(values.data());
+
+    // A dense cluster, in reverse order, among scattered and repeated points
+    std::vector<std::vector<size_t>> points;
+    for (size_t x = 27; x >= 22; --x) {
+        for (size_t y = 19; y >= 13; --y) {
+            points.push_back({x, y});
+        }
+    }
+    for (size_t i = 0; i < 40; ++i) {
+        points.push_back({(i * 13) % x_size, (i * 29) % y_size});
+    }
+    points.push_back({25, 15});
+
+    for (const auto& dataset : {chunked, contiguous}) {
+        std::vector<double> result;
+        dataset.select(ElementSet(points)).read(result);
+        std::vector<float> converted;
+        dataset.select(ElementSet(points)).read(converted);
+        BOOST_REQUIRE_EQUAL(result.size(), points.size());
+        BOOST_REQUIRE_EQUAL(converted.size(), points.size());
+        for (size_t i = 0; i < points.size(); ++i) {
+            const double expected = values[points[i][0] * y_size + points[i][1]];
+            BOOST_CHECK_EQUAL(result[i], expected);
+            BOOST_CHECK_EQUAL(converted[i], static_cast<float>(expected));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(selectionByHyperSlab) {
+    const std::string FILE_NAME("h5_test_selection_hyperslab.h5");
+    const size_t size = 8;
+    std::vector<int> values(size * size);
+    std::iota(values.begin(), values.end(), 0);
+
+    File file(FILE_NAME, File::ReadWrite | File::Create | File::Truncate);
+    DataSet dataset = file.createDataSet<int>("dset", DataSpace({size, size}));
+    dataset.write_raw(values.data());
+
+    // Elements selected by a predicate, in the order of the dataset
+    auto expected = [&](const std::function<bool(size_t, size_t)>& selected) {
+        std::vector<int> result;
+        for (size_t i = 0; i < size; ++i) {
+            for (size_t j = 0; j < size; ++j) {
+                if (selected(i, j)) {
+                    result.push_back(values[i * size + j]);
+                }
+            }
+        }
+        return result;
+    };
+
+    // A single hyperslab of tiles keeps its dimensions
+    RegularHyperSlab tiles({0, 0}, {2, 2}, {4, 4}, {2, 2});
+    std::vector<std::vector<int>> packed;
+    Selection tiled = dataset.select(HyperSlab(tiles));
+    BOOST_CHECK(tiled.getMemSpace().getDimensions() == std::vector<size_t>({4, 4}));
+    tiled.read(packed);
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            BOOST_CHECK_EQUAL(packed[i][j], values[(i / 2 * 4 + i % 2) * size + j / 2 * 4 + j % 2]);
+        }
+    }
+
+    auto in_tiles = [](size_t i, size_t j) { return i % 4 < 2 && j % 4 < 2; };
+    auto in_shifted = [](size_t i, size_t j) { return i % 4 >= 2 && j % 4 >= 2; };
+    auto in_rows = [](size_t i, size_t) { return i < 3; };
+    RegularHyperSlab shifted({2, 2}, {2, 2}, {4, 4}, {2, 2});
+    RegularHyperSlab rows({0, 0}, {3, size});
+
+    std::vector<int> result;
+    dataset.select(HyperSlab(tiles) | shifted).read(result);
+    BOOST_CHECK(result == expected([&](size_t i, size_t j) {
+        return in_tiles(i, j) || in_shifted(i, j);
+    }));
+    dataset.select(HyperSlab(tiles) & rows).read(result);
+    BOOST_CHECK(result == expected([&](size_t i, size_t j) {
+        return in_tiles(i, j) && in_rows(i, j);
+    }));
+    dataset.select(HyperSlab(tiles) ^ rows).read(result);
+    BOOST_CHECK(result == expected([&](size_t i, size_t j) {
+        return in_tiles(i, j) != in_rows(i, j);
+    }));
+    dataset.select(HyperSlab(rows).notB(tiles)).read(result);
+    BOOST_CHECK(result == expected([&](size_t i, size_t j) {
+        return in_rows(i, j) && !in_tiles(i, j);
+    }));
+    dataset.select(HyperSlab(rows).notA(tiles)).read(result);
+    BOOST_CHECK(result == expected([&](size_t i, size_t j) {
+        return in_tiles(i, j) && !in_rows(i, j);
+    }));
+    BOOST_CHECK_EQUAL(dataset.select(HyperSlab()).getMemSpace().getElementCount(), 0);
+
+    // Many unions, then a difference
+    HyperSlab diagonal;
+    for (size_t i = 0; i < size; ++i) {
+        diagonal |= RegularHyperSlab({i, i}, {1, 1});
+    }
+    diagonal.notB(RegularHyperSlab({2, 0}, {1, size}));
+    dataset.select(diagonal).read(result);
+    BOOST_CHECK(result == expected([](size_t i, size_t j) { return i == j && i != 2; }));
+
+    // Writing
+    std::vector<int> zeros(result.size(), 0);
+    dataset.select(diagonal).write(zeros);
+    result.resize(size * size);
+    dataset.read(result.data());
+    for (size_t i = 0; i < size; ++i) {
+        for (size_t j = 0; j < size; ++j) {
+            BOOST_CHECK_EQUAL(result[i * size + j],
+                              i == j && i != 2 ? 0 : values[i * size + j]);
+        }
+    }
+
+    BOOST_CHECK_THROW(RegularHyperSlab({0, 0}, {1}), DataSpaceException);
+}
+
+BOOST_AUTO_TEST_CASE(selectionShift) {
+    const std::string FILE_NAME("h5_test_selection_shift.h5");
+    const size_t n_rows = 100;
+    const size_t n_columns = 4;
+    std::vector<int> values(n_rows * n_columns);
+    std::iota(values.begin(), values.end(), 0);
+
+    File file(FILE_NAME, File::ReadWrite | File::Create | File::Truncate);
+    DataSet dataset = file.createDataSet<int>("dset", DataSpace({n_rows, n_columns}));
+    dataset.write_raw(values.data());
+
+    // Sliding window
+    const size_t window = 10;
+    Selection selection = dataset.select({0, 0}, {window, n_columns});
+    const Selection first = selection;
+    std::vector<int> result(window * n_columns);
+    for (size_t row = 0; row + window <= n_rows; row += 5) {
+        selection.read(result.data());
+        BOOST_CHECK(std::equal(result.begin(), result.end(), &values[row * n_columns]));
+        if (row + 5 + window <= n_rows) {
+            selection.shift({5, 0});
+        }
+    }
+    BOOST_CHECK(selection.getOffset() == std::vector<std::ptrdiff_t>({90, 0}));
+    first.read(result.data());
+    BOOST_CHECK_EQUAL(result[0], values[0]);
+
+    // Moving out of the dataset leaves the selection unchanged
+    BOOST_CHECK_THROW(selection.shift({1, 0}), DataSpaceException);
+    BOOST_CHECK_THROW(selection.setOffset({-1, 0}), DataSpaceException);
+    BOOST_CHECK_THROW(selection.shift({0}), DataSpaceException);
+    BOOST_CHECK(selection.getOffset() == std::vector<std::ptrdiff_t>({90, 0}));
+    selection.setOffset({3, 0}).read(result.data());
+    BOOST_CHECK(std::equal(result.begin(), result.end(), &values[3 * n_columns]));
+
+    // Points, unions of hyperslabs and columns
+    Selection points = dataset.select(ElementSet{{1, 1}, {4, 2}});
+    std::vector<int> two(2);
+    points.shift({10, 1}).read(two.data());
+    BOOST_CHECK_EQUAL(two[0], values[11 * n_columns + 2]);
+    BOOST_CHECK_EQUAL(two[1], values[14 * n_columns + 3]);
+
+    Selection slabs = dataset.select(HyperSlab(RegularHyperSlab({0, 0}, {1, 1})) |
+                                     RegularHyperSlab({2, 1}, {2, 2}));
+    std::vector<int> five(5);
+    slabs.setOffset({20, 1}).read(five.data());
+    BOOST_CHECK_EQUAL(five[0], values[20 * n_columns + 1]);
+    BOOST_CHECK_EQUAL(five[1], values[22 * n_columns + 2]);
+    BOOST_CHECK_EQUAL(five[4], values[23 * n_columns + 3]);
+
+    Selection columns = dataset.select(std::vector<size_t>{2, 0});
+    std::vector<int> column_values(n_rows * 2);
+    columns.shift({0, 1}).read(column_values.data());
+    BOOST_CHECK_EQUAL(column_values[0], values[3]);
+    BOOST_CHECK_EQUAL(column_values[1], values[1]);
+}
+
 template <typename T>
 void columnSelectionTest() {
     std::ostringstream filename;
@@ -934,6 +1677,237 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(columnSelection, T, numerical_test_types) {
     columnSelectionTest<T>();
 }
 
+BOOST_AUTO_TEST_CASE(columnSelectionOrder) {
+    const std::string FILE_NAME("h5_rw_select_column_order_test.h5");
+    const size_t x_size = 6;
+    const size_t y_size = 20;
+
+    std::vector<std::vector<int>> values(x_size, std::vector<int>(y_size));
+    for (size_t i = 0; i < x_size; ++i) {
+        for (size_t j = 0; j < y_size; ++j) {
+            values[i][j] = static_cast<int>(100 * i + j);
+        }
+    }
+
+    File file(FILE_NAME, File::ReadWrite | File::Create | File::Truncate);
+    DataSet dataset = file.createDataSet<int>("dset", DataSpace::From(values));
+    dataset.write(values);
+
+    // Regular pattern: a single strided hyperslab
+    std::vector<size_t> regular{2, 3, 6, 7, 10, 11, 14, 15};
+    Selection strided = dataset.select(regular);
+    BOOST_CHECK(H5Sis_regular_hyperslab(strided.getSpace().getId()) > 0);
+    std::vector<std::vector<int>> result;
+    strided.read(result);
+    for (size_t i = 0; i < x_size; ++i) {
+        for (size_t j = 0; j < regular.size(); ++j) {
+            BOOST_CHECK_EQUAL(result[i][j], values[i][regular[j]]);
+        }
+    }
+
+    // Unordered and repeated columns come back in the given order
+    std::vector<size_t> columns{17, 4, 5, 6, 0, 4, 19};
+    Selection unordered = dataset.select(columns);
+    BOOST_CHECK_EQUAL(unordered.getSpace().getElementCount(), x_size * y_size);
+    BOOST_CHECK_EQUAL(H5Sget_select_npoints(unordered.getSpace().getId()), 6 * x_size);
+    unordered.read(result);
+    std::vector<int> raw(x_size * columns.size());
+    unordered.read(raw.data());
+    const size_t padded_size = columns.size() + 3;
+    std::vector<int> padded(x_size * padded_size);
+    unordered.read(ArrayView<int, 2>(padded.data(), {x_size, columns.size()},
+                                     {padded_size, 1}));
+    for (size_t i = 0; i < x_size; ++i) {
+        for (size_t j = 0; j < columns.size(); ++j) {
+            BOOST_CHECK_EQUAL(result[i][j], values[i][columns[j]]);
+            BOOST_CHECK_EQUAL(raw[i * columns.size() + j], values[i][columns[j]]);
+            BOOST_CHECK_EQUAL(padded[i * padded_size + j], values[i][columns[j]]);
+        }
+    }
+
+    // Duplicates, in or out of order
+    for (const auto& duplicated : std::vector<std::vector<size_t>>{{1, 1, 3}, {3, 1, 1}, {2, 5, 5}}) {
+        dataset.select(duplicated).read(result);
+        BOOST_REQUIRE_EQUAL(result.size(), x_size);
+        for (size_t i = 0; i < x_size; ++i) {
+            BOOST_REQUIRE_EQUAL(result[i].size(), duplicated.size());
+            for (size_t j = 0; j < duplicated.size(); ++j) {
+                BOOST_CHECK_EQUAL(result[i][j], values[i][duplicated[j]]);
+            }
+        }
+    }
+
+    // Writing follows the given order too
+    std::vector<size_t> written{9, 1, 8};
+    std::vector<std::vector<int>> update(x_size, std::vector<int>(written.size()));
+    for (size_t i = 0; i < x_size; ++i) {
+        for (size_t j = 0; j < written.size(); ++j) {
+            update[i][j] = -static_cast<int>(10 * i + j);
+            values[i][written[j]] = update[i][j];
+        }
+    }
+    dataset.select(written).write(update);
+    dataset.read(result);
+    BOOST_CHECK(result == values);
+
+    // Many scattered columns, merged as a union of hyperslabs
+    const size_t wide_size = 1000;
+    std::vector<int> wide_values(2 * wide_size);
+    std::iota(wide_values.begin(), wide_values.end(), 0);
+    DataSet wide = file.createDataSet<int>("wide", DataSpace({2, wide_size}));
+    wide.write_raw(wide_values.data());
+    std::vector<size_t> scattered;
+    for (size_t i = 0; i < wide_size; ++i) {
+        if ((i * i) % 7 < 3) {
+            scattered.push_back(wide_size - 1 - i);
+        }
+    }
+    std::vector<int> gathered(2 * scattered.size());
+    wide.select(scattered).read(gathered.data());
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t j = 0; j < scattered.size(); ++j) {
+            BOOST_CHECK_EQUAL(gathered[i * scattered.size() + j],
+                              wide_values[i * wide_size + scattered[j]]);
+        }
+    }
+}
+
+template <typename T>
+void arrayViewTest() {
+    std::ostringstream filename;
+    filename << "h5_rw_array_view_" << typeNameHelper<T>() << "_test.h5";
+
+    const size_t x_size = 10;
+    const size_t y_size = 7;
+
+    T values[x_size][y_size];
+    ContentGenerate<T> generator;
+    generate2D(values, x_size, y_size, generator);
+
+    File file(filename.str(), File::ReadWrite | File::Create | File::Truncate);
+
+    // A column, from an interleaved array
+    DataSet column = file.createDataSet<T>("column", DataSpace(x_size));
+    column.write(ArrayView<const T, 1>(&values[0][2], {x_size}, {y_size}));
+    std::vector<T> column_result;
+    column.read(column_result);
+    for (size_t i = 0; i < x_size; ++i) {
+        BOOST_CHECK_EQUAL(column_result[i], values[i][2]);
+    }
+
+    // A sub-block, read back into a larger buffer with irregular strides
+    DataSet block = file.createDataSet<T>("block", DataSpace(4, 3));
+    block.write(ArrayView<T, 2>(&values[1][2], {4, 3}, {y_size, 1}));
+
+    std::vector<T> buffer(40);
+    block.read(ArrayView<T, 2>(buffer.data(), {4, 3}, {9, 2}));
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            BOOST_CHECK_EQUAL(buffer[9 * i + 2 * j], values[i + 1][j + 2]);
+        }
+    }
+
+    // Selections work the same
+    T row[3];
+    block.select({2, 0}, {1, 3}).read(ArrayView<T, 1>(row, {3}));
+    for (size_t j = 0; j < 3; ++j) {
+        BOOST_CHECK_EQUAL(row[j], values[3][j + 2]);
+    }
+
+    BOOST_CHECK_THROW(block.read(ArrayView<T, 1>(row, {3})), DataSpaceException);
+    BOOST_CHECK_THROW(block.read(ArrayView<T, 2>(buffer.data(), {4, 3}, {1, 4})),
+                      DataSpaceException);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(arrayView, T, numerical_test_types) {
+    arrayViewTest<T>();
+}
+
+BOOST_AUTO_TEST_CASE(numericConversions) {
+    File file("h5_numeric_conversions.h5", File::ReadWrite | File::Create | File::Truncate);
+
+    // Larger than a conversion block
+    std::vector<float> floats(300000);
+    for (size_t i = 0; i < floats.size(); ++i) {
+        floats[i] = 0.25f * static_cast<float>(i);
+    }
+    file.createDataSet("floats", floats);
+
+    std::vector<double> doubles;
+    file.getDataSet("floats").read(doubles);
+    BOOST_CHECK_EQUAL(doubles.size(), floats.size());
+    for (size_t i = 0; i < floats.size(); ++i) {
+        BOOST_CHECK_EQUAL(doubles[i], static_cast<double>(floats[i]));
+    }
+
+    file.getDataSet("floats").select({1}, {100000}, {3}).read(doubles);
+    BOOST_CHECK_EQUAL(doubles.size(), 100000);
+    BOOST_CHECK_EQUAL(doubles[99999], static_cast<double>(floats[299998]));
+
+    {
+        // Irregular selections larger than a conversion block are left to
+        // HDF5, with the warning about the type classes
+        std::vector<int> ints(300000);
+        std::iota(ints.begin(), ints.end(), 0);
+        DataSet ints_dataset = file.createDataSet("many_ints", ints);
+        const HyperSlab irregular =
+            HyperSlab(RegularHyperSlab({0}, {200000})) | RegularHyperSlab({220000}, {80000});
+        std::ostringstream warnings;
+        std::streambuf* cerr_buffer = std::cerr.rdbuf(warnings.rdbuf());
+        ints_dataset.select(irregular).read(doubles);
+        std::cerr.rdbuf(cerr_buffer);
+        BOOST_CHECK(!warnings.str().empty());
+        BOOST_CHECK_EQUAL(doubles.size(), 280000);
+        BOOST_CHECK_EQUAL(doubles[200000], 220000.);
+    }
+
+    // Narrowing floating point numbers is left to HDF5, which saturates
+    file.createDataSet("large", std::vector<double>{1e300, -1e300, 0.5});
+    std::vector<float> narrowed_floats;
+    file.getDataSet("large").read(narrowed_floats);
+    BOOST_CHECK(std::isinf(narrowed_floats[0]) && narrowed_floats[0] > 0);
+    BOOST_CHECK(std::isinf(narrowed_floats[1]) && narrowed_floats[1] < 0);
+    BOOST_CHECK_EQUAL(narrowed_floats[2], 0.5f);
+
+    // Non native byte order
+    const hsize_t dims[2] = {4, 5};
+    const hid_t space_id = H5Screate_simple(2, dims, nullptr);
+    const hid_t dataset_id = H5Dcreate2(file.getId(), "big_endian", H5T_STD_I16BE, space_id,
+                                        H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    const short shorts[4][5] = {{-1, 2, -3, 4, -5}, {6, -7, 8, -9, 10},
+                                {300, -300, 1000, -1000, 32767},
+                                {-32768, 0, 1, 2, 3}};
+    BOOST_CHECK(H5Dwrite(dataset_id, H5T_NATIVE_SHORT, H5S_ALL, H5S_ALL,
+                         H5P_DEFAULT, shorts) >= 0);
+    H5Dclose(dataset_id);
+    H5Sclose(space_id);
+
+    float as_floats[4][5];
+    long as_longs[4][5];
+    {
+        // No warning about the type classes, HighFive converting
+        std::ostringstream warnings;
+        std::streambuf* cerr_buffer = std::cerr.rdbuf(warnings.rdbuf());
+        file.getDataSet("big_endian").read(as_floats);
+        std::cerr.rdbuf(cerr_buffer);
+        BOOST_CHECK(warnings.str().empty());
+    }
+    file.getDataSet("big_endian").read(as_longs);
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 5; ++j) {
+            BOOST_CHECK_EQUAL(as_floats[i][j], static_cast<float>(shorts[i][j]));
+            BOOST_CHECK_EQUAL(as_longs[i][j], static_cast<long>(shorts[i][j]));
+        }
+    }
+
+    // Narrowing is left to HDF5, which saturates
+    file.createDataSet("ints", std::vector<int>{100000, -100000});
+    std::vector<short> narrowed;
+    file.getDataSet("ints").read(narrowed);
+    BOOST_CHECK_EQUAL(narrowed[0], 32767);
+    BOOST_CHECK_EQUAL(narrowed[1], -32768);
+}
+
 template <typename T>
 void attribute_scalar_rw() {
     std::ostringstream filename;
@@ -1573,6 +2547,95 @@ BOOST_AUTO_TEST_CASE(HighFiveFixedLenStringArrayStructure) {
         BOOST_CHECK_EQUAL(arr2.size(), 1);
         BOOST_CHECK_EQUAL(arr2[0], std::string("0000000"));
     }
+
+    // bulk conversions
+    {
+        const std::vector<std::string> strings{"a", "", "0123456789abc", "bcd"};
+        const fixed_array_t arr(strings);
+        BOOST_CHECK_EQUAL(arr.size(), 4);
+        BOOST_CHECK_EQUAL(arr.length(2), 9);
+        // Padding is zeroed
+        BOOST_CHECK(std::all_of(arr[0] + 1, arr[0] + 10, [](char c) { return c == 0; }));
+
+        const std::vector<std::string> expected{"a", "", "012345678", "bcd"};
+        BOOST_CHECK(arr.getStrings() == expected);
+        std::vector<std::string> back{"to", "be", "replaced", "with", "more"};
+        arr.getStrings(back);
+        BOOST_CHECK(back == expected);
+
+        const fixed_array_t from_column(StringColumn{"a", "", "0123456789abc", "bcd"});
+        BOOST_CHECK(from_column.getStrings() == expected);
+        BOOST_CHECK(std::equal(arr.begin(), arr.end(), from_column.begin()));
+
+#if __cplusplus >= 201703L
+        BOOST_CHECK(arr.getStringView(3) == "bcd");
+        BOOST_CHECK_EQUAL(arr.getStringViews().size(), 4);
+#endif
+
+        // Strings filling the whole slot, without null terminator
+        const char raw[][4] = {{'a', 'b', 'c', 'd'}, {'e', 0, 0, 0}};
+        FixedLenStringArray<4> unterminated(raw, 2);
+        BOOST_CHECK_EQUAL(unterminated.getString(0), "abcd");
+        BOOST_CHECK_EQUAL(unterminated.getString(1), "e");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(HighFiveStringColumn) {
+    const std::string FILE_NAME("string_column.h5");
+    File file(FILE_NAME, File::ReadWrite | File::Create | File::Truncate);
+
+    StringColumn column{"alpha", "", "gamma"};
+    column.push_back(std::string(500, 'x'));
+    BOOST_CHECK_EQUAL(column.size(), 4);
+    BOOST_CHECK_EQUAL(column.length(1), 0);
+    BOOST_CHECK_EQUAL(column.getString(2), "gamma");
+
+    auto ds = file.createDataSet("column", column);
+
+    // Interoperates with std::vector<std::string>
+    std::vector<std::string> vec;
+    ds.read(vec);
+    BOOST_CHECK_EQUAL(vec.size(), 4);
+    BOOST_CHECK_EQUAL(vec[0], "alpha");
+    BOOST_CHECK_EQUAL(vec[3], std::string(500, 'x'));
+
+    StringColumn column_back;
+    ds.read(column_back);
+    BOOST_CHECK_EQUAL(column_back.size(), 4);
+    for (size_t i = 0; i < column.size(); ++i) {
+        BOOST_CHECK_EQUAL(column_back.getString(i), column.getString(i));
+        BOOST_CHECK_EQUAL(column_back.length(i), column.length(i));
+    }
+
+    // Many strings, more characters than the initial guess, read in a
+    // column which already holds data
+    std::vector<std::string> many(1000);
+    for (size_t i = 0; i < many.size(); ++i) {
+        many[i] = std::string(i % 100, char('a' + i % 26));
+    }
+    file.createDataSet("many", many);
+    file.getDataSet("many").read(column_back);
+    BOOST_CHECK_EQUAL(column_back.size(), many.size());
+    for (size_t i = 0; i < many.size(); ++i) {
+        BOOST_CHECK_EQUAL(std::string(column_back[i]), many[i]);
+    }
+
+    // Selections
+    StringColumn selected;
+    file.getDataSet("many").select({10}, {5}).read(selected);
+    BOOST_CHECK_EQUAL(selected.size(), 5);
+    BOOST_CHECK_EQUAL(selected.getString(4), many[14]);
+
+    StringColumn replacement{"one", "two"};
+    file.getDataSet("many").select({0}, {2}).write(replacement);
+    file.getDataSet("many").read(vec);
+    BOOST_CHECK_EQUAL(vec[1], "two");
+    BOOST_CHECK_EQUAL(vec[2], many[2]);
+
+    BOOST_CHECK_THROW(file.getDataSet("many").select({0}, {3}).write(replacement),
+                      DataSpaceException);
+    file.createDataSet<int>("ints", DataSpace(2));
+    BOOST_CHECK_THROW(file.getDataSet("ints").read(selected), DataSetException);
 }
 
 BOOST_AUTO_TEST_CASE(HighFiveReference) {
@@ -125,6 +125,35 @@ BOOST_AUTO_TEST_CASE(H5Easy_vector2d_compression)
     BOOST_CHECK_EQUAL(a == a_r, true);
 }
 
+BOOST_AUTO_TEST_CASE(H5Easy_vector2d_auto_chunking)
+{
+    H5Easy::File file("test.h5", H5Easy::File::Overwrite);
+
+    std::vector<std::vector<double>> a(300, std::vector<double>(20, 1.));
+
+    H5Easy::dump(file, "/path/to/a", a,
+        H5Easy::DumpOptions(H5Easy::Compression(), H5Easy::AutoChunking(8 * 1024)));
+
+    std::vector<hsize_t> chunks{38, 20};
+    BOOST_CHECK(HighFive::details::get_chunk_dims(file.getDataSet("/path/to/a")) ==
+                std::vector<size_t>(chunks.begin(), chunks.end()));
+    decltype(a) a_r = H5Easy::load<decltype(a)>(file, "/path/to/a");
+    BOOST_CHECK_EQUAL(a == a_r, true);
+
+    // An explicit chunk-size has precedence
+    H5Easy::DumpOptions options(H5Easy::AutoChunking(), H5Easy::DumpMode::Overwrite);
+    options.setChunkSize({10, 10});
+    std::vector<hsize_t> chunks_set{10, 10};
+    BOOST_CHECK(options.getChunkSize(H5Easy::DataSpace::From(a),
+                                     H5Easy::AtomicType<double>()) == chunks_set);
+
+    // Extendible DataSets
+    H5Easy::dump(file, "/path/to/b", 1., {0},
+        H5Easy::DumpOptions(H5Easy::AutoChunking(1024)));
+    BOOST_CHECK(HighFive::details::get_chunk_dims(file.getDataSet("/path/to/b")) ==
+                std::vector<size_t>{128});
+}
+
 BOOST_AUTO_TEST_CASE(H5Easy_vector3d)
 {
     H5Easy::File file("test.h5", H5Easy::File::Overwrite);
@@ -12,6 +12,8 @@
 
 #include <highfive/H5DataSet.hpp>
 #include <highfive/H5File.hpp>
+#include <highfive/H5TypedDataSet.hpp>
+#include <highfive/H5Utility.hpp>
 
 
 #ifdef H5_USE_BOOST
@@ -119,6 +121,155 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(readWrite4DVector, T, numerical_test_types) {
     readWriteVectorNDTest<T>(_4dvec, {5, 4, 3, 2});
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(readWriteDefaultInitVector, T, numerical_test_types) {
+    using vector_t = std::vector<T, DefaultInitAllocator<T>>;
+    vector_t vec(50);
+    std::generate(vec.begin(), vec.end(), ContentGenerate<T>());
+
+    vector_t result;
+    readWriteDataset<T>(vec, result, 1, "default-init-vector");
+    BOOST_CHECK(vec == result);
+
+    std::vector<vector_t> _2dvec(10, vec);
+    std::vector<vector_t> _2dresult;
+    readWriteDataset<T>(_2dvec, _2dresult, 2, "default-init-vector");
+    BOOST_CHECK(_2dvec == _2dresult);
+}
+
+template <typename T>
+void readWriteNestedVectorBlocksTest(const std::vector<size_t>& dims) {
+    std::ostringstream filename;
+    filename << "h5_rw_nested_blocks_" << dims[0] << "_" << typeNameHelper<T>()
+             << "_test.h5";
+    File file(filename.str(), File::ReadWrite | File::Create | File::Truncate);
+
+    std::vector<std::vector<T>> vec;
+    fillVec(vec, dims, ContentGenerate<T>());
+    DataSet dataset = file.createDataSet<T>("dset", DataSpace::From(vec));
+    dataset.write(vec);
+
+    std::vector<std::vector<T>> result;
+    dataset.read(result);
+    BOOST_CHECK(checkLength(result, dims));
+    BOOST_CHECK(vec == result);
+
+    // Every other row, through a strided selection
+    std::vector<std::vector<T>> odd_rows;
+    dataset.select({1, 0}, {dims[0] / 2, dims[1]}, {2, 1}).read(odd_rows);
+    BOOST_CHECK_EQUAL(odd_rows.size(), dims[0] / 2);
+    for (size_t i = 0; i < odd_rows.size(); ++i) {
+        BOOST_CHECK(odd_rows[i] == vec[2 * i + 1]);
+    }
+
+    // Overwrite them, leaving the even rows untouched
+    for (auto& row : odd_rows) {
+        std::reverse(row.begin(), row.end());
+    }
+    dataset.select({1, 0}, {dims[0] / 2, dims[1]}, {2, 1}).write(odd_rows);
+    dataset.read(result);
+    for (size_t i = 0; i < dims[0]; ++i) {
+        BOOST_CHECK(result[i] == (i % 2 ? odd_rows[i / 2] : vec[i]));
+    }
+
+    std::vector<std::vector<T>> bad_rows(dims[0], std::vector<T>(dims[1] + 1));
+    BOOST_CHECK_THROW(dataset.write(bad_rows), DataSetException);
+}
+
+BOOST_AUTO_TEST_CASE(readWriteNestedVectorBlocks) {
+    // Several blocks of rows, with a partial last one
+    readWriteNestedVectorBlocksTest<double>({301, 4000});
+    // Rows larger than a block, transferred directly
+    readWriteNestedVectorBlocksTest<float>({4, 1200000});
+}
+
+template <typename T>
+void typedDataSetTest() {
+    std::ostringstream filename;
+    filename << "h5_typed_dataset_" << typeNameHelper<T>() << "_test.h5";
+    File file(filename.str(), File::ReadWrite | File::Create | File::Truncate);
+
+    const size_t rows = 6, cols = 5;
+    std::vector<T> values(rows * cols);
+    std::generate(values.begin(), values.end(), ContentGenerate<T>());
+
+    DataSet dataset = file.createDataSet<T>("dset", DataSpace({rows, cols}));
+    TypedDataSet<T, 2> typed(dataset);
+    BOOST_CHECK(typed.getDimensions() == (std::array<size_t, 2>{{rows, cols}}));
+    BOOST_CHECK_EQUAL(typed.getElementCount(), rows * cols);
+    typed.write(values.data());
+
+    std::array<T, 4> block;
+    for (size_t i = 0; i < rows; i += 2) {
+        typed.read({i, 1}, {2, 2}, block.data());
+        BOOST_CHECK(block[0] == values[i * cols + 1]);
+        BOOST_CHECK(block[3] == values[(i + 1) * cols + 2]);
+    }
+
+    const TypedSelection<T, 2> column = typed.select({0, 4}, {rows, 1});
+    BOOST_CHECK_EQUAL(column.getElementCount(), rows);
+    std::vector<T> column_values(rows);
+    column.read(column_values.data());
+    for (size_t i = 0; i < rows; ++i) {
+        BOOST_CHECK(column_values[i] == values[i * cols + 4]);
+    }
+
+    TypedSelection<T, 2> window = typed.select({0, 1}, {2, 2});
+    const TypedSelection<T, 2> first_window = window;
+    for (size_t i = 0; i < rows; i += 2) {
+        window.setOffset({i, 1}).read(block.data());
+        BOOST_CHECK(block[0] == values[i * cols + 1]);
+        BOOST_CHECK(block[3] == values[(i + 1) * cols + 2]);
+    }
+    BOOST_CHECK(window.getOffset() == (std::array<size_t, 2>{{rows - 2, 1}}));
+    first_window.read(block.data());
+    BOOST_CHECK(block[0] == values[1]);
+    BOOST_CHECK_THROW(window.setOffset({rows - 1, 1}), DataSpaceException);
+    BOOST_CHECK(window.getOffset() == (std::array<size_t, 2>{{rows - 2, 1}}));
+
+    const std::array<T, 2> corner{{values[0], values[1]}};
+    typed.write({rows - 1, cols - 2}, {1, 2}, corner.data());
+    std::vector<T> result(rows * cols);
+    typed.read(result.data());
+    BOOST_CHECK(result[rows * cols - 2] == values[0]);
+    BOOST_CHECK(result[rows * cols - 1] == values[1]);
+    BOOST_CHECK(result[0] == values[0]);
+
+    BOOST_CHECK_THROW(typed.read({rows - 1, 0}, {2, 1}, block.data()), DataSpaceException);
+    BOOST_CHECK_THROW((TypedDataSet<T, 3>(dataset)), DataSetException);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(typedDataSet, T, numerical_test_types) {
+    typedDataSetTest<T>();
+}
+
+BOOST_AUTO_TEST_CASE(typedDataSetChecks) {
+    File file("h5_typed_dataset_checks.h5", File::ReadWrite | File::Create | File::Truncate);
+
+    DataSet floats = file.createDataSet<float>("floats", DataSpace({4}));
+    BOOST_CHECK_THROW((TypedDataSet<int, 1>(floats)), DataTypeException);
+    // No conversion within a type class either
+    BOOST_CHECK_THROW((TypedDataSet<double, 1>(floats)), DataTypeException);
+    DataSet bytes = file.createDataSet<int8_t>("bytes", DataSpace({4}));
+    BOOST_CHECK_THROW((TypedDataSet<int64_t, 1>(bytes)), DataTypeException);
+    BOOST_CHECK_THROW((TypedDataSet<uint8_t, 1>(bytes)), DataTypeException);
+    TypedDataSet<float, 1> typed_floats(floats);
+    const float values[4] = {1.f, 2.f, 3.f, 4.f};
+    typed_floats.write(values);
+
+    DataSetCreateProps props;
+    props.add(Chunking(std::vector<hsize_t>{2}));
+    DataSet extensible = file.createDataSet<int>(
+        "extensible", DataSpace({2}, {DataSpace::UNLIMITED}), props);
+    TypedDataSet<int, 1> ints(extensible);
+    ints.resize({{6}});
+    BOOST_CHECK_EQUAL(ints.getElementCount(), 6);
+    const int tail[2] = {5, 6};
+    ints.write({{4}}, {{2}}, tail);
+    std::vector<int> result;
+    extensible.read(result);
+    BOOST_CHECK_EQUAL(result.size(), 6);
+    BOOST_CHECK_EQUAL(result[5], 6);
+}
 
 
 #ifdef H5_USE_BOOST
@@ -97,3 +97,110 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(selectionArraySimple, T, numerical_test_types) {
 
     selectionArraySimpleTestParallel<T>();
 }
+
+BOOST_AUTO_TEST_CASE(collectiveTransfers) {
+    int mpi_rank, mpi_size;
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    const size_t n_rows = 16;
+    const auto rank = static_cast<size_t>(mpi_rank);
+    std::vector<int> values(n_rows);
+    for (size_t i = 0; i < n_rows; ++i) {
+        values[i] = static_cast<int>(rank * n_rows + i);
+    }
+
+    File file("h5_collective_parallel_test.h5", File::ReadWrite | File::Create | File::Truncate,
+              MPIOFileDriver(MPI_COMM_WORLD, MPI_INFO_NULL));
+    DataSet dataset = file.createDataSet<int>(
+        "dset", DataSpace({static_cast<size_t>(mpi_size), n_rows}));
+
+    DataTransferProps collective;
+    collective.add(UseCollectiveIO());
+    dataset.select({rank, 0}, {1, n_rows}).write_raw(values.data(), DataType(), collective);
+    BOOST_CHECK(getMpioActualIOMode(collective) == MpioIOMode::ContiguousCollective);
+    BOOST_CHECK_EQUAL(getMpioNoCollectiveCause(collective).second, H5D_MPIO_COLLECTIVE);
+
+    // Each rank reads the row of the next one
+    const size_t next = (rank + 1) % static_cast<size_t>(mpi_size);
+    std::vector<int> result(n_rows);
+    dataset.select({next, 0}, {1, n_rows}).read(result.data(), DataType(), collective);
+    for (size_t i = 0; i < n_rows; ++i) {
+        BOOST_CHECK_EQUAL(result[i], static_cast<int>(next * n_rows + i));
+    }
+
+    DataTransferProps independent;
+    independent.add(UseCollectiveIO(false));
+    dataset.select({rank, 0}, {1, n_rows}).read(result.data(), DataType(), independent);
+    BOOST_CHECK(getMpioActualIOMode(independent) == MpioIOMode::NoCollective);
+    BOOST_CHECK_EQUAL(result[0], values[0]);
+}
+
+BOOST_AUTO_TEST_CASE(writeDistributed) {
+    int mpi_rank, mpi_size;
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    const auto rank = static_cast<size_t>(mpi_rank);
+    const auto size = static_cast<size_t>(mpi_size);
+    const size_t n_columns = 3;
+
+    File file("h5_distributed_parallel_test.h5", File::ReadWrite | File::Create | File::Truncate,
+              MPIOFileDriver(MPI_COMM_WORLD, MPI_INFO_NULL));
+    DataSetCreateProps props;
+    props.add(Chunking(std::vector<hsize_t>{4, n_columns}));
+    DataSet dataset = file.createDataSet<int>(
+        "dset", DataSpace({0, n_columns}, {DataSpace::UNLIMITED, n_columns}), props);
+
+    // Rank r appends r rows, twice, holding its rank
+    for (size_t pass = 0; pass < 2; ++pass) {
+        const std::vector<int> rows(rank * n_columns, mpi_rank);
+        const size_t first_row = dataset.writeDistributed(MPI_COMM_WORLD, rows);
+        BOOST_CHECK_EQUAL(first_row, pass * size * (size - 1) / 2 + rank * (rank - 1) / 2);
+    }
+    BOOST_CHECK_EQUAL(dataset.getDimensions()[0], size * (size - 1));
+
+    std::vector<int> result(size * (size - 1) * n_columns);
+    dataset.read(result.data());
+    size_t index = 0;
+    for (size_t pass = 0; pass < 2; ++pass) {
+        for (size_t r = 0; r < size; ++r) {
+            for (size_t i = 0; i < r * n_columns; ++i) {
+                BOOST_CHECK_EQUAL(result[index++], static_cast<int>(r));
+            }
+        }
+    }
+
+    const std::vector<int> partial(n_columns + 1);
+    BOOST_CHECK_THROW(dataset.writeDistributed(MPI_COMM_WORLD, partial), DataSpaceException);
+}
+
+BOOST_AUTO_TEST_CASE(mpioHintsAndCollectiveMetadata) {
+    int mpi_rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    MPIOHints hints;
+    hints.setCollectiveBufferingNodes(1)
+        .setCollectiveBufferSize(1024 * 1024)
+        .setCollectiveBufferingWrite(MPIOHints::Toggle::Enable)
+        .setCollectiveBufferingRead(MPIOHints::Toggle::Automatic)
+        .setStripingFactor(1)
+        .setStripingUnit(1024 * 1024);
+    BOOST_CHECK_EQUAL(hints.getHints().at("romio_cb_write"), "enable");
+    BOOST_CHECK_EQUAL(hints.getHints().at("cb_buffer_size"), "1048576");
+
+    MPIOFileDriver driver(MPI_COMM_WORLD, hints);
+    driver.add(MPIOCollectiveMetadataRead());
+    driver.add(MPIOCollectiveMetadataWrite());
+    {
+        File file("h5_hints_parallel_test.h5",
+                  File::ReadWrite | File::Create | File::Truncate, driver);
+        DataSet dataset = file.createDataSet<int>("dset", DataSpace({4}));
+        dataset.write(std::vector<int>{0, 1, 2, 3});
+    }
+
+    File file("h5_hints_parallel_test.h5", File::ReadOnly, driver);
+    std::vector<int> result;
+    file.getDataSet("dset").read(result);
+    BOOST_CHECK_EQUAL(result.size(), 4);
+    BOOST_CHECK_EQUAL(result[3], 3);
+}